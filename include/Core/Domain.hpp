@@ -0,0 +1,70 @@
+#pragma once
+#include "SpeciesTraits.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+namespace Domain {
+
+// 🧩 DÉCOUPAGE DU MONDE EN TUILES, UN PROCESSUS PAR TUILE
+// Le monde est partagé en colonnes × lignes rectangles. Chaque tuile est un
+// Ecosystem autonome, dans son propre processus (fork), en coordonnées
+// locales. À chaque fin de tick, chaque tuile échange avec ses huit voisines,
+// par des sockets Unix :
+//  - les migrants, entités sorties de la tuile, qui passent chez la voisine ;
+//  - les prédateurs fantômes, carnivores à moins d'un rayon de perception du
+//    bord commun, que les herbivores voisins doivent voir pour les fuir.
+// Le processus coordinateur (l'appelant) reçoit le bilan de chaque tuile à
+// chaque tick et en fait les statistiques globales.
+struct Config {
+    float worldWidth = 1200.0f;
+    float worldHeight = 800.0f;
+    int columns = 2;
+    int rows = 2;
+    int maxEntities = 500;   // Pour le monde entier, réparti entre les tuiles
+    int herbivores = 20;     // Populations initiales du monde entier
+    int carnivores = 5;
+    int plants = 30;
+    uint32_t seed = 42;
+    std::size_t threadsPerTile = 1;
+    long long ticks = 10000;
+    float deltaTime = 0.1f;
+    long long reportInterval = 1000;  // Ticks entre deux affichages du coordinateur (0 = jamais)
+};
+
+// 📊 BILAN D'UNE TUILE POUR UN TICK (transmis tel quel au coordinateur)
+struct TileReport {
+    uint64_t tick;
+    int32_t population[kSpeciesCount];  // Indicée par EntityType
+    int32_t births;      // Pendant ce tick
+    int32_t deaths;      // Pendant ce tick
+    uint32_t emigrants;  // Entités parties chez une voisine pendant ce tick
+    float food;
+    float updateSeconds;    // Ecosystem::Update
+    float exchangeSeconds;  // Échange avec les voisines, attente comprise
+};
+
+// 🌍 STATISTIQUES DU MONDE ENTIER
+struct GlobalStatistics {
+    long long ticks = 0;
+    std::array<long long, kSpeciesCount> population = {};  // Indicée par EntityType
+    long long births = 0;      // Cumulés depuis le début
+    long long deaths = 0;
+    long long migrations = 0;
+    double food = 0.0;
+    // ⏱ Tuile la plus lente : celle dont simulation + échange ont duré le plus sur
+    // toute la simulation. Les deux durées sont celles de cette seule tuile : leur
+    // somme ne dépasse pas la durée réelle.
+    double slowestUpdateSeconds = 0.0;
+    double slowestExchangeSeconds = 0.0;
+};
+
+// 🚀 Lance une simulation découpée et attend la fin de toutes les tuiles.
+// À appeler avant de créer le moindre thread : fork ne duplique que l'appelant.
+bool Run(const Config& config, GlobalStatistics& statistics);
+
+} // namespace Domain
+} // namespace Core
+} // namespace Ecosystem
@@ -1,27 +1,105 @@
 #pragma once
 #include "Entity.hpp"
+#include "EntityStore.hpp"
+#include "FoodField.hpp"
+#include "SpatialGrid.hpp"
 #include "Structs.hpp"
-#include <vector>
+#include "ThreadPool.hpp"
+#include "TimingWheel.hpp"
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 #include <random>
 
 namespace Ecosystem {
 namespace Core {
 
+// ⏱ PHASES D'UN TICK, dans l'ordre d'exécution de Ecosystem::Update
+enum class Phase : uint8_t {
+    RANDOM,         // Tirages aléatoires du tick
+    SPATIAL_INDEX,  // Reconstruction de l'index des prédateurs
+    STEERING,       // Perception et forces de pilotage
+    MOTION,         // Noyau de mouvement et de métabolisme
+    EATING,
+    REPRODUCTION,
+    REMOVAL,        // Retrait des entités mortes
+    GROWTH,         // Nouvelles plantes et repousse de la nourriture
+    STATISTICS,
+    COUNT
+};
+static constexpr std::size_t kPhaseCount = static_cast<std::size_t>(Phase::COUNT);
+const char* PhaseName(Phase phase);
+
+// 📅 Un jour simulé : fenêtre des compteurs de naissances et de morts du jour
+static constexpr int kTicksPerDay = 1000;
+static constexpr std::size_t kHistogramBuckets = 16;
+
+// 🎲 Graine par défaut : sans graine explicite, deux exécutions sont identiques
+static constexpr uint32_t kDefaultSeed = 42;
+
 class Ecosystem {
 private:
     // 🔒 ÉTAT INTERNE
-    std::vector<std::unique_ptr<Entity>> mEntities;
-    std::vector<Food> mFoodSources;
+    EntityStore mEntities;
     float mWorldWidth;
     float mWorldHeight;
     int mMaxEntities;
-    int mDayCycle;
+    uint64_t mDayCycle;  // Ticks écoulés, sur 64 bits comme les horloges de l'échéancier
+    bool mVerbose;  // Messages de création, d'initialisation et de destruction
+    FoodField mFood;
+
+    // 🗺 INDEX SPATIAL DES PRÉDATEURS (reconstruit à chaque tick)
+    SpatialGrid mPredatorIndex;
+
+    // 🧩 TUILE D'UN MONDE DÉCOUPÉ - bords du monde entier et prédateurs des tuiles voisines
+    Vector2D mBoundsMinimum;
+    Vector2D mBoundsMaximum;
+    std::vector<Vector2D> mGhostPredators;
+
+    // 🧵 PARALLÉLISME - naissances collectées par travailleur puis fusionnées
+    std::unique_ptr<ThreadPool> mThreadPool;
+    std::vector<std::vector<uint32_t>> mBirthBuffers;
+    std::vector<uint32_t> mBirthOrder;
+    std::vector<EntityHandle> mBirthParents;  // Une naissance peut déplacer les entités des espèces suivantes
+
+    // ⏲ ÉCHÉANCIER - morts par l'âge, reproductions paresseuses et pousses de plantes,
+    // à l'horloge de l'EntityStore. Un événement périmé (entité retouchée ou
+    // disparue entre-temps) est reconnu et ignoré quand il échoit.
+    TimingWheel mEvents;
+    std::vector<TimedEvent> mDueEvents;
+    std::vector<EntityHandle> mLazyDead;     // Morts paresseuses du tick, retirées avec les autres
+    std::vector<EntityHandle> mLazyParents;  // Reproductions dues ce tick
+    uint64_t mNextPlantSpawn;                // Horloge de la prochaine pousse
+    bool mPlantSpawnDue;
     
     // 🎲 Générateur aléatoire
-    std::mt19937 mRandomGenerator;
-    
-    // 📊 STATISTIQUES
+    mutable std::mt19937 mRandomGenerator;
+
+public:
+    // 📈 RÉPARTITION D'UNE GRANDEUR SUR UNE ESPÈCE (entités vivantes)
+    // L'histogramme porte sur la fraction du maximum propre à chaque entité
+    // (énergie / énergie maximale, âge / âge maximal), en kHistogramBuckets classes.
+    struct Distribution {
+        float minimum;
+        float maximum;
+        float mean;
+        std::array<uint32_t, kHistogramBuckets> histogram;
+    };
+
+    // 🧬 STATISTIQUES D'UNE ESPÈCE
+    struct SpeciesStatistics {
+        int population;
+        long long births;        // Depuis le début de la simulation
+        long long deaths;
+        int birthsToday;         // Depuis le début du jour en cours
+        int deathsToday;
+        int birthsYesterday;     // Dernier jour complet
+        int deathsYesterday;
+    };
+
+    // 📊 STATISTIQUES - compteurs tenus à jour là où les entités naissent et meurent
     struct Statistics {
         int totalHerbivores;
         int totalCarnivores;
@@ -29,11 +107,39 @@ private:
         int totalFood;
         int deathsToday;
         int birthsToday;
-    } mStats;
+        int deathsYesterday;
+        int birthsYesterday;
+        long long totalBirths;
+        long long totalDeaths;
+        int day;  // Jour en cours (kTicksPerDay ticks par jour)
+        std::array<SpeciesStatistics, kSpeciesCount> species;
+    };
+
+    // 📈 RÉPARTITIONS PAR ESPÈCE - calculées à la demande, au plus une fois par tick
+    struct SpeciesDistributions {
+        Distribution energy;
+        Distribution age;
+    };
+    using Distributions = std::array<SpeciesDistributions, kSpeciesCount>;
+
+    // ⏱ BILAN DU DERNIER TICK
+    struct TickReport {
+        int births;
+        int deaths;
+        std::array<float, kPhaseCount> phaseSeconds;
+        float totalSeconds;
+    };
+
+private:
+    Statistics mStats;
+    mutable Distributions mDistributions;  // Complétées par GetDistributions
+    mutable bool mDistributionsValid;
+    TickReport mLastTick;
 
 public:
     // 🏗 CONSTRUCTEUR/DESTRUCTEUR
-    Ecosystem(float width, float height, int maxEntities = 500);
+    Ecosystem(float width, float height, int maxEntities = 500,
+              uint32_t seed = kDefaultSeed, bool verbose = true);
     ~Ecosystem();
     
     // ⚙️ MÉTHODES PUBLIQUES
@@ -42,28 +148,68 @@ public:
     void SpawnFood(int count);
     void RemoveDeadEntities();
     void HandleReproduction();
-    void HandleEating();
+    void HandleEating(float deltaTime);
+    void SetThreadCount(std::size_t threadCount);
+
+    // 🧬 ESPÈCES - paramètres des entités créées ensuite
+    void SetSpecies(EntityType type, const SpeciesParameters& parameters);
+    const SpeciesParameters& GetSpecies(EntityType type) const { return mEntities.GetSpecies(type); }
     
     // 📊 GETTERS
-    int GetEntityCount() const { return mEntities.size(); }
-    int GetFoodCount() const { return mFoodSources.size(); }
-    Statistics GetStatistics() const { return mStats; }
+    int GetEntityCount() const { return static_cast<int>(mEntities.Size()); }
+    int GetFoodCount() const { return static_cast<int>(mFood.GetTotalUnits()); }
+    const FoodField& GetFoodField() const { return mFood; }
+    uint64_t GetDayCycle() const { return mDayCycle; }
+    int GetMaxEntities() const { return mMaxEntities; }
+    std::size_t GetThreadCount() const { return mThreadPool->GetThreadCount(); }
+    const Statistics& GetStatistics() const { return mStats; }  // O(1)
+    const Distributions& GetDistributions() const;  // O(N) au premier appel après un changement, O(1) ensuite
+    int GetPopulation(EntityType type) const { return static_cast<int>(mEntities.SpeciesCount(type)); }
+    const TickReport& GetLastTick() const { return mLastTick; }
     float GetWorldWidth() const { return mWorldWidth; }
     float GetWorldHeight() const { return mWorldHeight; }
+    const SpatialGrid& GetPredatorIndex() const { return mPredatorIndex; }
+    // 🔑 Empreinte de tout l'état simulé : égale entre deux exécutions tant qu'elles ne divergent pas
+    uint64_t ComputeStateHash() const;
     
     // 🎯 MÉTHODES DE GESTION
-    void AddEntity(std::unique_ptr<Entity> entity);
+    Entity AddEntity(EntityType type, Vector2D position, const std::string& name = "");  // Nom vide : aucun nom attribué
+    Entity GetEntity(std::size_t index) { return Entity(mEntities, index); }
+    std::optional<Entity> FindEntity(EntityHandle handle);
+    const EntityStore& GetEntities() const { return mEntities; }
     void AddFood(Vector2D position, float energy = 25.0f);
-    
-    // 🎨 RENDU
-    void Render(SDL_Renderer* renderer) const;
+
+    // 💾 INSTANTANÉS - état complet (entités, nourriture, aléa, statistiques, cycle)
+    bool SaveSnapshot(const std::string& path) const;
+    bool LoadSnapshot(const std::string& path);  // L'état courant est conservé en cas d'échec
+
+    // 🧩 TUILE D'UN MONDE DÉCOUPÉ (Core/Domain) - coordonnées locales à la tuile
+    void SetWorldBounds(Vector2D minimum, Vector2D maximum);  // Bords du monde entier, pour l'évitement
+    void SetIdBase(uint64_t base) { mEntities.SetNextId(base); }  // Identifiants uniques entre tuiles
+    void SetGhostPredators(const std::vector<Vector2D>& positions) { mGhostPredators = positions; }
+    // Retire les entités hors de [minimum, maximum) ; renvoie leur nombre
+    std::size_t ExtractEmigrants(Vector2D minimum, Vector2D maximum,
+                                 std::vector<Migrant>& migrants, std::vector<char>& names);
+    void AddImmigrants(const std::vector<Migrant>& migrants, const std::vector<char>& names);
 
 private:
     // 🔐 MÉTHODES PRIVÉES
     void UpdateStatistics();
-    void SpawnRandomEntity(EntityType type);
+    void UpdateSpatialIndex();
+    void HandleSteering(float deltaTime);
+    bool SpawnRandomEntity(EntityType type);
     Vector2D GetRandomPosition() const;
-    void HandlePlantGrowth(float deltaTime);
+    void HandlePlantGrowth();
+    void CountPopulations();
+    void RecordBirth(EntityType type);
+    void RecordDeaths(EntityType type, int count);
+    void AdvanceDay();
+    void ComputeDistributions() const;
+    void ScheduleEntity(std::size_t index);
+    void ScheduleReproduction(std::size_t index, uint64_t from);
+    void SchedulePlantSpawn();
+    void RescheduleAll();
+    void FireEvents();
 };
 
 } // namespace Core
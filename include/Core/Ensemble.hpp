@@ -0,0 +1,88 @@
+#pragma once
+#include "EntityStore.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+namespace Ensemble {
+
+// 🎲 CONFIGURATION D'UNE EXÉCUTION
+struct RunConfig {
+    std::size_t index = 0;
+    float worldWidth = 1200.0f;
+    float worldHeight = 800.0f;
+    int maxEntities = 500;
+    int herbivores = 20;
+    int carnivores = 5;
+    int plants = 30;
+    uint32_t seed = 42;
+    long long ticks = 10000;
+    float deltaTime = 0.1f;
+    std::array<SpeciesParameters, kSpeciesCount> species = DefaultSpeciesTable();
+};
+
+// 📋 SPÉCIFICATION DE BALAYAGE
+// Une ligne par paramètre, « clé = valeurs » ; les exécutions forment le
+// produit cartésien de toutes les listes (la dernière clé varie le plus vite).
+//
+//   # commentaire
+//   herbivores = 10, 20, 40
+//   seed = 1..100                 # entiers de 1 à 100 inclus
+//   herbivore.metabolism = 1.0..2.0:0.25
+//   carnivore.max_age = 150, 200
+//
+// Clés : world_width, world_height, max_entities, herbivores, carnivores,
+// plants, seed, ticks, dt, et <espèce>.<paramètre> avec espèce parmi
+// herbivore, carnivore, plant et paramètre parmi initial_energy, max_energy,
+// metabolism, max_age, size, reproduction_chance.
+class Sweep {
+private:
+    std::vector<std::string> mKeys;
+    std::vector<std::vector<std::string>> mValues;
+    RunConfig mBase;  // Valeurs des paramètres qui ne sont pas balayés
+
+public:
+    // 📖 Lecture et validation de chaque valeur ; `error` décrit la première faute
+    bool Parse(std::istream& input, std::string& error);
+    bool Load(const std::string& path, std::string& error);
+    void SetBase(const RunConfig& base) { mBase = base; }
+
+    // 🔢 PRODUIT CARTÉSIEN
+    std::size_t GetRunCount() const;
+    RunConfig GetRun(std::size_t index) const;
+    const std::vector<std::string>& GetKeys() const { return mKeys; }
+    std::vector<std::string> GetValues(std::size_t index) const;  // Une valeur par clé
+};
+
+// 📊 BILAN D'UNE EXÉCUTION
+struct RunSummary {
+    std::size_t index;
+    long long ticks;               // Ticks réellement simulés
+    int extinctSpecies;            // Première espèce éteinte (EntityType), -1 si aucune
+    long long extinctionTick;
+    std::array<int, kSpeciesCount> finalPopulation;
+    std::array<int, kSpeciesCount> peakPopulation;
+    std::array<double, kSpeciesCount> meanPopulation;
+    long long births;
+    long long deaths;
+    double seconds;
+};
+
+// ▶️ UNE EXÉCUTION, sur le thread appelant. Une espèce présente au départ qui
+// disparaît arrête la simulation si `stopOnExtinction`.
+RunSummary Run(const RunConfig& config, bool stopOnExtinction);
+
+// 🚀 ENSEMBLE - `threads` exécutions simultanées (0 = tous les cœurs), chacune
+// avec son propre Ecosystem : aucun état mutable partagé. Une ligne CSV par
+// exécution est écrite dans `output` dès qu'elle se termine (ordre d'achèvement).
+bool RunSweep(const Sweep& sweep, std::size_t threads, bool stopOnExtinction, std::ostream& output);
+
+} // namespace Ensemble
+} // namespace Core
+} // namespace Ecosystem
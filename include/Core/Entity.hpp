@@ -1,80 +1,77 @@
 #pragma once
+#include "EntityStore.hpp"
+#include "FoodField.hpp"
+#include "SpatialGrid.hpp"
 #include "Structs.hpp"
-#include <SDL3/SDL.h>
-#include <memory>
-#include <random>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace Ecosystem {
 namespace Core {
 
-// 🎯 ÉNUMÉRATION DES TYPES D'ENTITÉS
-enum class EntityType {
-    HERBIVORE,
-    CARNIVORE,
-    PLANT
-};
-
+// 👁 VUE SUR UNE ENTITÉ
+// Accès léger (stockage + indice dense) aux tableaux de l'EntityStore.
+// Elle ne possède aucune donnée : l'indice n'est valide que jusqu'au
+// prochain retrait d'entité. Pour une référence durable, conserver une
+// EntityHandle (GetHandle) et la résoudre au moment de l'utiliser.
 class Entity {
 private:
-    // 🔒 DONNÉES PRIVÉES - État interne protégé
-    float mEnergy;
-    float mMaxEnergy;
-    int mAge;
-    int mMaxAge;
-    bool mIsAlive;
-    Vector2D mVelocity;
-    EntityType mType;
-    
-    // 🎲 Générateur aléatoire
-    mutable std::mt19937 mRandomGenerator;
+    // 🔒 RÉFÉRENCE VERS LE STOCKAGE
+    EntityStore* mStore;
+    std::size_t mIndex;
 
 public:
-    // 🔓 DONNÉES PUBLIQUES - Accès direct sécurisé
-    Vector2D position;
-    Color color;
-    float size;
-    std::string name;
+    // 🏗 CONSTRUCTEUR
+    Entity(EntityStore& store, std::size_t index) : mStore(&store), mIndex(index) {}
 
-    // 🏗 CONSTRUCTEURS
-    Entity(EntityType type, Vector2D pos, std::string entityName = "Unnamed");
-    Entity(const Entity& other);  // Constructeur de copie
-    
-    // 🗑 DESTRUCTEUR
-    ~Entity();
-    
     // ⚙️ MÉTHODES PUBLIQUES
     void Update(float deltaTime);
-    void Move(float deltaTime);
     void Eat(float energy);
     bool CanReproduce() const;
-    std::unique_ptr<Entity> Reproduce();
+    bool WantsToReproduce() const;
+    std::optional<Entity> Reproduce();
+    // 🌿 Espèce paresseuse : première horloge >= from (avant deathTick) où WantsToReproduce
+    // sera vrai, ou point de contrôle si la recherche est trop longue ; kNever si jamais
+    uint64_t NextReproductionTick(uint64_t from, uint64_t deathTick) const;
     void ApplyForce(Vector2D force);
-    
-    // 📊 GETTERS - Accès contrôlé aux données privées
-    float GetEnergy() const { return mEnergy; }
-    float GetEnergyPercentage() const { return mEnergy / mMaxEnergy; }
-    int GetAge() const { return mAge; }
-    bool IsAlive() const { return mIsAlive; }
-    EntityType GetType() const { return mType; }
-    Vector2D GetVelocity() const { return mVelocity; }
-    
+
+    // 📊 GETTERS - Accès contrôlé aux données du stockage
+    std::size_t GetIndex() const { return mIndex; }
+    EntityHandle GetHandle() const { return mStore->GetHandle(mIndex); }
+    float GetEnergy() const { return mStore->GetEnergy(mIndex); }
+    float GetEnergyPercentage() const { return GetEnergy() / mStore->maxEnergy[mIndex]; }
+    int GetAge() const { return mStore->GetAge(mIndex); }
+    bool IsAlive() const { return mStore->alive[mIndex] != 0; }
+    EntityType GetType() const { return mStore->type[mIndex]; }
+    Vector2D GetVelocity() const { return Vector2D(mStore->velocityX[mIndex], mStore->velocityY[mIndex]); }
+    Vector2D GetPosition() const { return Vector2D(mStore->positionX[mIndex], mStore->positionY[mIndex]); }
+    Color GetColor() const { return mStore->color[mIndex]; }
+    float GetSize() const { return mStore->size[mIndex]; }
+    uint64_t GetId() const { return mStore->id[mIndex]; }
+    std::string GetName() const { return mStore->GetName(mIndex); }  // Mis en forme à chaque appel
+
+    // ✏️ SETTERS
+    void SetPosition(Vector2D pos) { mStore->positionX[mIndex] = pos.x; mStore->positionY[mIndex] = pos.y; }
+
     // 🎯 MÉTHODES DE COMPORTEMENT
-    Vector2D SeekFood(const std::vector<Food>& foodSources) const;
-    Vector2D AvoidPredators(const std::vector<Entity>& predators) const;
-    Vector2D StayInBounds(float worldWidth, float worldHeight) const;
-    
-    // 🎨 MÉTHODE DE RENDU
-    void Render(SDL_Renderer* renderer) const;
+    // Les perceptions interrogent un index spatial : coût borné par agent
+    Vector2D SeekFood(const FoodField& food) const;
+    Vector2D AvoidPredators(const SpatialGrid& predatorIndex) const;
+    Vector2D StayInBounds(Vector2D minimum, Vector2D maximum) const;
 
-private:
-    // 🔐 MÉTHODES PRIVÉES - Logique interne
-    void ConsumeEnergy(float deltaTime);
-    void Age(float deltaTime);
-    void CheckVitality();
-    Vector2D GenerateRandomDirection();
+    // 👶 CONDITIONS DE REPRODUCTION
+    static constexpr float kReproductionEnergyRatio = 0.8f;
+    static constexpr int kReproductionMinAge = 20;
+
+    // 👁 PARAMÈTRES DE PERCEPTION
+    static constexpr float kPerceptionRadius = 80.0f;
+    static constexpr std::size_t kMaxSensedPredators = 8;
+
+    // 🎨 COULEUR D'AFFICHAGE (le rendu lui-même vit dans Graphics)
     Color CalculateColorBasedOnState() const;
+    static Color CalculateColor(Color baseColor, float energyRatio);
 };
 
 } // namespace Core
-} // namespace Ecosystem
\ No newline at end of file
+} // namespace Ecosystem
@@ -0,0 +1,229 @@
+#pragma once
+#include "NameTable.hpp"
+#include "Random.hpp"
+#include "Snapshot.hpp"
+#include "SpeciesTraits.hpp"
+#include "Structs.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+
+// 🪪 IDENTIFIANT D'ENTITÉ (64 bits)
+// [espèce : 4 bits][génération : 12 bits][numéro de série : 48 bits]
+// Le numéro de série est unique dans la simulation ; la génération compte les
+// ascendants (0 pour une entité créée, plafonnée à kMaxGeneration). L'identifiant
+// ne change jamais : il sert de clé aux flux aléatoires et au journal.
+static constexpr unsigned kEntityIdSerialBits = 48;
+static constexpr unsigned kEntityIdGenerationBits = 12;
+static constexpr uint64_t kEntityIdSerialMask = (uint64_t(1) << kEntityIdSerialBits) - 1;
+static constexpr uint32_t kMaxGeneration = (1u << kEntityIdGenerationBits) - 1;
+
+constexpr uint64_t MakeEntityId(EntityType species, uint32_t generation, uint64_t serial) {
+    return (static_cast<uint64_t>(species) << (kEntityIdSerialBits + kEntityIdGenerationBits)) |
+           (static_cast<uint64_t>(generation < kMaxGeneration ? generation : kMaxGeneration) << kEntityIdSerialBits) |
+           (serial & kEntityIdSerialMask);
+}
+constexpr EntityType EntityIdSpecies(uint64_t entityId) {
+    return static_cast<EntityType>(entityId >> (kEntityIdSerialBits + kEntityIdGenerationBits));
+}
+constexpr uint32_t EntityIdGeneration(uint64_t entityId) {
+    return static_cast<uint32_t>(entityId >> kEntityIdSerialBits) & kMaxGeneration;
+}
+constexpr uint64_t EntityIdSerial(uint64_t entityId) { return entityId & kEntityIdSerialMask; }
+
+// 📝 Nom lisible, construit seulement à l'affichage : « Herbivore_42 », « Herbivore_42 (g3) »
+std::string FormatEntityId(uint64_t entityId);
+
+// 🔗 POIGNÉE GÉNÉRATIONNELLE
+// Référence stable vers une entité : l'emplacement survit aux déplacements
+// dans les tableaux denses, et la génération invalide la poignée dès que
+// l'emplacement est recyclé pour une autre entité.
+struct EntityHandle {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(const EntityHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+// 🧳 ENTITÉ EN TRANSIT ENTRE DEUX STOCKAGES (découpage en tuiles, voir Core/Domain)
+// Copie brute de tous les attributs persistants ; un éventuel nom attribué
+// suit dans un tampon de caractères séparé, dans l'ordre des entités.
+struct Migrant {
+    float positionX;
+    float positionY;
+    float velocityX;
+    float velocityY;
+    float speed;
+    float energy;
+    float metabolism;
+    float maxEnergy;
+    float size;
+    int32_t age;
+    int32_t maxAge;
+    uint32_t nameLength;  // Nom attribué (0 : aucun), transmis à part
+    uint64_t id;
+    Color color;
+    EntityType type;
+    uint8_t padding[3];
+};
+
+// 🗄 STOCKAGE DES ENTITÉS EN STRUCTURE DE TABLEAUX (SoA)
+// Chaque attribut vit dans son propre tableau contigu : les boucles de
+// simulation parcourent uniquement les données dont elles ont besoin.
+// Les tableaux sont denses (pas de trou) : une mort est retirée en O(1) en
+// déplaçant la dernière entité à sa place, et les emplacements libérés
+// sont recyclés par une liste libre. Une fois la capacité réservée, ni
+// naissance ni mort n'alloue de mémoire.
+// Les entités sont rangées par espèce, dans l'ordre d'EntityType : chaque
+// espèce occupe une plage contiguë [SpeciesBegin, SpeciesEnd) que les boucles
+// parcourent avec un code spécialisé pour ses traits. Une insertion ou un
+// retrait déplace au plus une entité par espèce suivante.
+class EntityStore {
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // 🔥 DONNÉES CHAUDES - lues à chaque tick
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> speed;  // Norme de la vitesse, tenue à jour à chaque écriture de la vitesse
+    std::vector<float> energy;
+    std::vector<float> metabolism;  // Énergie consommée par seconde (négative pour les plantes)
+    std::vector<float> maxEnergy;
+    std::vector<int> age;
+    std::vector<int> maxAge;
+    std::vector<EntityType> type;
+    std::vector<uint8_t> alive;
+    std::vector<std::array<float, 4>> uniforms;  // Tirages du tick courant
+
+    // 🧊 DONNÉES FROIDES - rendu et identification
+    std::vector<float> size;
+    std::vector<Color> color;
+    std::vector<uint64_t> id;  // Identifiant unique (voir MakeEntityId), clé des flux aléatoires
+    std::vector<uint32_t> slot;  // Emplacement de la poignée de chaque entité dense
+    std::vector<uint64_t> touchTick;  // Espèces paresseuses : horloge à laquelle energy et age sont exacts
+
+    // ⚙️ GESTION DU STOCKAGE
+    std::size_t Size() const { return type.size(); }
+    bool Empty() const { return type.empty(); }
+    void Clear();
+    void Reserve(std::size_t capacity);
+
+    // 🧬 PLAGES PAR ESPÈCE
+    std::size_t SpeciesBegin(EntityType entityType) const { return mSpeciesBegin[static_cast<std::size_t>(entityType)]; }
+    std::size_t SpeciesEnd(EntityType entityType) const { return mSpeciesBegin[static_cast<std::size_t>(entityType) + 1]; }
+    std::size_t SpeciesCount(EntityType entityType) const { return SpeciesEnd(entityType) - SpeciesBegin(entityType); }
+
+    // Découpe [begin, end) selon les espèces : function(SpeciesTag<...>(), from, to)
+    // pour chaque morceau non vide, le type de l'étiquette donnant accès aux traits
+    template <typename Function>
+    void ForEachSpeciesRange(std::size_t begin, std::size_t end, Function&& function) const {
+        ForEachSpecies([&](auto species) {
+            std::size_t from = std::max(begin, SpeciesBegin(decltype(species)::value));
+            std::size_t to = std::min(end, SpeciesEnd(decltype(species)::value));
+            if (from < to) function(species, from, to);
+        });
+    }
+
+    // 🎲 ALÉA PAR COMPTEUR - flux indexés par (graine, identifiant, tick)
+    void SetSeed(uint64_t seed) { mSeed = seed; }
+    uint64_t GetSeed() const { return mSeed; }
+    uint64_t GetTick() const { return mTick; }
+    void SetTick(uint64_t tick) { mTick = tick; }
+    void DrawTickUniforms(std::size_t begin, std::size_t end);
+
+    // 🌿 ESPÈCES PARESSEUSES (SpeciesTraits::kLazy)
+    // Leur énergie et leur âge ne sont pas avancés à chaque tick : energy[i] et
+    // age[i] sont exacts à l'horloge touchTick[i] et l'état courant s'en déduit
+    // en forme close. L'horloge compte les pas appliqués ; la durée du pas est
+    // constante entre deux changements (SetLazyStep).
+    static constexpr uint64_t kNever = UINT64_MAX;
+    uint64_t GetLazyClock() const { return mLazyClock; }
+    void AdvanceLazyClock() { ++mLazyClock; }
+    // true si le pas change : toutes les entités paresseuses sont d'abord ramenées à l'horloge
+    bool SetLazyStep(float deltaTime);
+    bool HasLazyStep() const { return mLazyDeltaTime >= 0.0f; }
+    float GetEnergy(std::size_t index) const;  // Valeurs courantes, quelle que soit l'espèce
+    int GetAge(std::size_t index) const;
+    float GetEnergyAt(std::size_t index, uint64_t clock) const;  // Espèce paresseuse, clock >= touchTick
+    int GetAgeAt(std::size_t index, uint64_t clock) const;
+    float GetLazyDeltaTime() const { return mLazyDeltaTime; }
+    std::array<float, 4> GetUniforms(std::size_t index) const;  // Tirages du tick (de l'horloge si paresseuse)
+    void Touch(std::size_t index);  // energy et age ramenés à l'horloge
+    // Horloge du pas qui tue l'entité, kNever sinon : âge ou faim pour une espèce
+    // paresseuse, âge seulement pour les autres (leur faim dépend de leurs déplacements)
+    uint64_t DeathTick(std::size_t index) const;
+
+    // 🧬 ESPÈCES - n'affecte que les entités créées ensuite
+    const SpeciesParameters& GetSpecies(EntityType entityType) const { return mSpecies[static_cast<std::size_t>(entityType)]; }
+    void SetSpecies(EntityType entityType, const SpeciesParameters& parameters) { mSpecies[static_cast<std::size_t>(entityType)] = parameters; }
+
+    // 🏗 CRÉATION - renvoie l'indice de la nouvelle entité
+    std::size_t Add(EntityType entityType, Vector2D pos);
+    std::size_t AddChild(std::size_t parent);
+
+    // 🏷 NOMS - seules les entités nommées explicitement occupent de la mémoire ;
+    // les autres sont désignées par leur identifiant, mis en forme à la demande
+    void SetName(std::size_t index, const std::string& entityName);
+    std::string GetName(std::size_t index) const;
+
+    // 🧳 MIGRATION - l'identifiant est conservé, le nom attribué est ajouté à `names`
+    void Export(std::size_t index, Migrant& migrant, std::vector<char>& names) const;
+    std::size_t Import(const Migrant& migrant, const char* entityName);
+    void SetNextId(uint64_t nextId) { mNextId = nextId; }
+
+    // 💀 SUPPRESSION - échange avec la dernière entité puis retrait
+    void RemoveAt(std::size_t index);
+    // Renvoie le nombre d'entités retirées ; `removedBySpecies` reçoit le détail par espèce.
+    // Les plages des espèces paresseuses ne sont pas parcourues : leurs morts,
+    // connues d'avance, sont désignées par `lazyDead`.
+    std::size_t RemoveDead(const std::vector<EntityHandle>& lazyDead = {},
+                           std::array<std::size_t, kSpeciesCount>* removedBySpecies = nullptr);
+
+    // 🔗 POIGNÉES
+    EntityHandle GetHandle(std::size_t index) const { return {slot[index], mSlotGeneration[slot[index]]}; }
+    std::size_t Resolve(EntityHandle handle) const;  // npos si l'entité n'existe plus
+    bool IsValid(EntityHandle handle) const { return Resolve(handle) != npos; }
+
+    // 💾 INSTANTANÉ - Load ne modifie rien si une section manque ou est incohérente
+    void Save(Snapshot::Writer& writer) const;
+    bool Load(const Snapshot::Reader& reader);
+
+private:
+    uint64_t mSeed = 0;
+    uint64_t mTick = 0;
+    uint64_t mNextId = 0;
+    uint64_t mLazyClock = 0;
+    float mLazyDeltaTime = -1.0f;  // Négatif tant qu'aucun pas n'a été appliqué
+    int mLazyAgeStep = 0;
+    std::array<std::size_t, kSpeciesCount + 1> mSpeciesBegin = {};  // Dernière case : Size()
+    std::array<SpeciesParameters, kSpeciesCount> mSpecies = DefaultSpeciesTable();
+
+    // 🏷 NOMS ATTRIBUÉS (identifiant -> chaîne internée)
+    NameTable mNameTable;
+    std::unordered_map<uint64_t, uint32_t> mAssignedNames;
+    const std::string* FindAssignedName(std::size_t index) const;
+
+    // 🧮 TABLE DES EMPLACEMENTS (poignée -> indice dense)
+    std::vector<uint32_t> mSlotToIndex;
+    std::vector<uint32_t> mSlotGeneration;
+    std::vector<uint32_t> mFreeSlots;
+
+    std::size_t Emplace(uint64_t entityId);
+    std::vector<std::size_t> mLazyRemovals;  // Tampon de RemoveDead
+
+    void MoveSlot(std::size_t from, std::size_t to);  // Copie d'une entité, poignée suivie
+    void Resize(std::size_t count);
+};
+
+} // namespace Core
+} // namespace Ecosystem
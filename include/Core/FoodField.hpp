@@ -0,0 +1,65 @@
+#pragma once
+#include "Snapshot.hpp"
+#include "Structs.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🌾 CHAMP DE NOURRITURE
+// Grille dense de quantités de nourriture (en unités) avec un taux de
+// repousse par cellule. La mémoire dépend de la résolution de la grille,
+// pas du nombre d'unités : un monde peut contenir des millions d'unités.
+class FoodField {
+private:
+    // 🔒 GÉOMÉTRIE
+    float mCellSize;
+    float mInverseCellSize;
+    int mColumns;
+    int mRows;
+    float mCellCapacity;  // Unités maximales par cellule
+
+    // 🗄 DONNÉES PAR CELLULE
+    std::vector<float> mUnits;
+    std::vector<float> mRegrowthRate;  // Unités par seconde
+    double mTotalUnits;
+
+public:
+    // Énergie apportée par une unité de nourriture
+    static constexpr float kEnergyPerUnit = 25.0f;
+
+    // 🏗 CONSTRUCTEUR
+    FoodField(float width, float height, float cellSize, float cellCapacity);
+
+    // ⚙️ MISE À JOUR
+    void Clear();
+    void SetRegrowthRate(std::size_t cell, float unitsPerSecond) { mRegrowthRate[cell] = unitsPerSecond; }
+    void Regrow(float deltaTime);
+
+    // 🍎 DÉPÔT / CONSOMMATION EN O(1) - renvoient la quantité effective
+    float Deposit(Vector2D position, float units);
+    float Consume(Vector2D position, float units);
+
+    // 🔍 Centre de la cellule la plus proche contenant au moins `minUnits`
+    bool FindNearest(Vector2D position, float maxRadius, float minUnits, Vector2D& found) const;
+
+    // 📊 GETTERS
+    std::size_t GetCellCount() const { return mUnits.size(); }
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+    float GetCellSize() const { return mCellSize; }
+    float GetCellCapacity() const { return mCellCapacity; }
+    float GetUnits(std::size_t cell) const { return mUnits[cell]; }
+    float GetRegrowthRate(std::size_t cell) const { return mRegrowthRate[cell]; }
+    double GetTotalUnits() const { return mTotalUnits; }
+    Vector2D GetCellCenter(std::size_t cell) const;
+    std::size_t GetCellIndex(Vector2D position) const;
+
+    // 💾 INSTANTANÉ - Load ne modifie rien si une section manque ou est incohérente
+    void Save(Snapshot::Writer& writer) const;
+    bool Load(const Snapshot::Reader& reader);
+};
+
+} // namespace Core
+} // namespace Ecosystem
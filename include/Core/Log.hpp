@@ -0,0 +1,119 @@
+#pragma once
+#include "RingBuffer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+// 🔧 NIVEAU MINIMAL COMPILÉ (0 = TRACE ... 4 = ERROR, 5 = rien)
+// Les appels sous ce niveau disparaissent entièrement du binaire.
+#ifndef ECOSYSTEM_LOG_LEVEL
+#define ECOSYSTEM_LOG_LEVEL 2
+#endif
+
+namespace Ecosystem {
+namespace Core {
+namespace Log {
+
+// 🎚 NIVEAUX DE JOURNALISATION
+enum class Level : uint8_t {
+    TRACE = 0,
+    DEBUG = 1,
+    INFO = 2,
+    WARNING = 3,
+    ERROR = 4
+};
+
+// 🏷 ÉVÉNEMENTS STRUCTURÉS DES CHEMINS CRITIQUES
+enum class Event : uint8_t {
+    ENTITY_CREATED,     // values: x, y
+    ENTITY_BORN,        // values: énergie initiale
+    ENTITY_DESTROYED,   // integer: âge
+    ENTITY_ATE,         // values: énergie gagnée
+    ENTITY_STARVED,     // integer: âge
+    ENTITY_DIED_OF_AGE  // integer: âge
+};
+
+// 📦 ENREGISTREMENT BINAIRE - aucune mise en forme à l'émission
+struct Record {
+    uint64_t timestamp;   // nanosecondes (horloge monotone)
+    uint64_t entityId;
+    float values[2];
+    int32_t integer;
+    Level level;
+    Event event;
+};
+
+// 📤 DESTINATION DES ENREGISTREMENTS (appelée depuis le thread de vidage)
+class Sink {
+public:
+    virtual ~Sink() = default;
+    virtual void Consume(const Record& record) = 0;
+};
+
+// 🖥 Mise en forme texte, uniquement quand le puits est branché
+class StreamSink : public Sink {
+private:
+    std::ostream& mStream;
+
+public:
+    explicit StreamSink(std::ostream& stream) : mStream(stream) {}
+    void Consume(const Record& record) override;
+};
+
+// 📜 JOURNAL ASYNCHRONE
+// Les producteurs déposent des enregistrements dans une file sans verrou ;
+// un thread d'arrière-plan la vide vers les puits. Si aucun puits n'est
+// branché, rien n'est déposé ni mis en forme.
+class Logger {
+private:
+    MpscRingBuffer<Record> mQueue;
+    std::vector<std::unique_ptr<Sink>> mSinks;
+    std::mutex mSinkMutex;
+    std::atomic<bool> mHasSinks;
+    std::atomic<uint8_t> mLevel;
+    std::atomic<uint64_t> mDropped;
+    std::atomic<bool> mRunning;
+    std::thread mDrainThread;
+
+    Logger();
+
+public:
+    ~Logger();
+    static Logger& Instance();
+
+    // ⚙️ CONFIGURATION
+    void AddSink(std::unique_ptr<Sink> sink);
+    void SetLevel(Level level) { mLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+    uint64_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+    void Flush();
+
+    // ✍️ ÉMISSION (chemin critique : une comparaison, un dépôt)
+    void Write(Level level, Event event, uint64_t entityId, float value0 = 0.0f,
+               float value1 = 0.0f, int32_t integer = 0);
+
+private:
+    void DrainLoop();
+    bool DrainOnce();
+};
+
+const char* LevelName(Level level);
+
+} // namespace Log
+} // namespace Core
+} // namespace Ecosystem
+
+// 🔇 MACROS - filtrées à la compilation selon ECOSYSTEM_LOG_LEVEL
+#define ECOSYSTEM_LOG(level, ...)                                                              \
+    do {                                                                                       \
+        if constexpr (static_cast<int>(level) >= ECOSYSTEM_LOG_LEVEL) {                        \
+            ::Ecosystem::Core::Log::Logger::Instance().Write(level, __VA_ARGS__);              \
+        }                                                                                      \
+    } while (0)
+
+#define ECOSYSTEM_LOG_TRACE(...) ECOSYSTEM_LOG(::Ecosystem::Core::Log::Level::TRACE, __VA_ARGS__)
+#define ECOSYSTEM_LOG_DEBUG(...) ECOSYSTEM_LOG(::Ecosystem::Core::Log::Level::DEBUG, __VA_ARGS__)
+#define ECOSYSTEM_LOG_INFO(...) ECOSYSTEM_LOG(::Ecosystem::Core::Log::Level::INFO, __VA_ARGS__)
@@ -0,0 +1,49 @@
+#pragma once
+#include "EntityStore.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+namespace Motion {
+
+// 🏃 NOYAU DE MOUVEMENT ET DE MÉTABOLISME
+// Avance un bloc d'entités d'un pas de temps : métabolisme, vieillissement,
+// changement de direction occasionnel, déplacement, coût du mouvement et
+// mort de faim ; la mort par l'âge, prévisible, est programmée par
+// l'écosystème (Core/TimingWheel). Les chemins vectoriels traitent 4 (SSE2) ou 8 (AVX2)
+// entités par instruction et produisent exactement les mêmes bits que le
+// chemin scalaire : mêmes opérations, dans le même ordre, sans FMA.
+enum class Path : uint8_t {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+// 🎲 Probabilité de changer de direction par tick : tirage 0 du tick strictement inférieur
+static constexpr float kTurnChance = 0.02f;
+
+// 🎂 Vieillissement accéléré pour la simulation, identique pour toutes les entités du pas
+inline int AgeStep(float deltaTime) {
+    return static_cast<int>(deltaTime * 10.0f);
+}
+
+// 🔍 DÉTECTION DU PROCESSEUR
+bool IsSupported(Path path);
+Path GetBestPath();
+const char* PathName(Path path);
+
+// ⚙️ CHEMIN ACTIF - le meilleur disponible par défaut, modifiable pour les comparaisons
+Path GetActivePath();
+bool SetActivePath(Path path);  // false si le processeur ne le supporte pas
+
+// 🔄 AVANCE DES ENTITÉS [begin, end) - renvoie le nombre de morts du bloc
+// Le bloc est découpé selon les plages d'espèces de l'EntityStore ; les
+// espèces immobiles ne passent que par le métabolisme et le vieillissement,
+// et les espèces paresseuses sont ignorées (voir EntityStore::AdvanceLazyClock).
+std::size_t Advance(EntityStore& store, std::size_t begin, std::size_t end, float deltaTime);
+std::size_t Advance(Path path, EntityStore& store, std::size_t begin, std::size_t end, float deltaTime);
+
+} // namespace Motion
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 TABLE DE CHAÎNES INTERNÉES
+// Chaque chaîne distincte n'est stockée qu'une fois et désignée par un indice
+// 32 bits. Les chaînes ne sont jamais déplacées (deque) : les références
+// renvoyées par Get restent valides jusqu'à Clear.
+class NameTable {
+private:
+    std::deque<std::string> mStrings;
+    std::unordered_map<std::string, uint32_t> mIndices;
+
+public:
+    // 📥 Indice de la chaîne, ajoutée si elle est nouvelle
+    uint32_t Intern(const std::string& text) {
+        auto found = mIndices.find(text);
+        if (found != mIndices.end()) return found->second;
+        uint32_t index = static_cast<uint32_t>(mStrings.size());
+        mStrings.push_back(text);
+        mIndices.emplace(text, index);
+        return index;
+    }
+
+    const std::string& Get(uint32_t index) const { return mStrings[index]; }
+    std::size_t Size() const { return mStrings.size(); }
+
+    void Clear() {
+        mStrings.clear();
+        mIndices.clear();
+    }
+};
+
+} // namespace Core
+} // namespace Ecosystem
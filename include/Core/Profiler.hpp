@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 🔧 INSTRUMENTATION COMPILÉE (1 = zones actives, 0 = retirées du binaire)
+// Par défaut active en debug et absente des builds de production (NDEBUG).
+#ifndef ECOSYSTEM_PROFILING
+#ifdef NDEBUG
+#define ECOSYSTEM_PROFILING 0
+#else
+#define ECOSYSTEM_PROFILING 1
+#endif
+#endif
+
+namespace Ecosystem {
+namespace Core {
+namespace Profiler {
+
+// ⏱ PROFILEUR À ZONES
+// Chaque thread écrit ses zones terminées dans son propre tampon, sans
+// verrou ni atomique partagé ; rien n'est enregistré hors capture. Les
+// tampons sont relevés par Collect entre deux ticks (aucune zone ouverte
+// ailleurs), puis exportés au format Chrome Trace (chrome://tracing, Perfetto).
+struct Event {
+    const char* name;    // Littéral : seul le pointeur est conservé
+    uint64_t start;      // Nanosecondes, horloge monotone
+    uint64_t duration;   // Nanosecondes
+    uint32_t thread;     // Numéro attribué au premier enregistrement du thread
+};
+
+// 🕒 Horloge des zones (steady_clock, en nanosecondes)
+uint64_t Now();
+
+// 🎬 CAPTURE - désactivée par défaut
+void SetCapturing(bool capturing);
+bool IsCapturing();
+
+// ✍️ ENREGISTREMENT
+void Record(const char* name, uint64_t start, uint64_t end);  // Zone aux bornes déjà mesurées
+void SetThreadName(const char* name);                         // Littéral, affiché dans la trace
+
+// 📥 RELEVÉ - déplace les zones de tous les threads dans `out` (ajoutées à la fin)
+void Collect(std::vector<Event>& out);
+uint64_t GetDroppedCount();  // Zones perdues car un tampon était plein
+
+// 💾 EXPORT CHROME TRACE (JSON)
+bool WriteChromeTrace(const std::string& path, const std::vector<Event>& events);
+
+// 📏 ZONE À PORTÉE
+class Zone {
+private:
+    const char* mName;
+    uint64_t mStart;
+
+public:
+    explicit Zone(const char* name) : mName(name), mStart(IsCapturing() ? Now() : 0) {}
+    ~Zone() {
+        if (mStart != 0) Record(mName, mStart, Now());
+    }
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+};
+
+} // namespace Profiler
+} // namespace Core
+} // namespace Ecosystem
+
+// 🔇 MACROS - vides si ECOSYSTEM_PROFILING vaut 0
+#if ECOSYSTEM_PROFILING
+#define ECOSYSTEM_PROFILE_CONCAT_INNER(a, b) a##b
+#define ECOSYSTEM_PROFILE_CONCAT(a, b) ECOSYSTEM_PROFILE_CONCAT_INNER(a, b)
+#define ECOSYSTEM_PROFILE_ZONE(name) \
+    ::Ecosystem::Core::Profiler::Zone ECOSYSTEM_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define ECOSYSTEM_PROFILE_RECORD(name, start, end)                   \
+    do {                                                             \
+        if (::Ecosystem::Core::Profiler::IsCapturing()) {            \
+            ::Ecosystem::Core::Profiler::Record(name, start, end);   \
+        }                                                            \
+    } while (0)
+#define ECOSYSTEM_PROFILE_THREAD(name) ::Ecosystem::Core::Profiler::SetThreadName(name)
+#else
+#define ECOSYSTEM_PROFILE_ZONE(name) ((void)0)
+#define ECOSYSTEM_PROFILE_RECORD(name, start, end) ((void)0)
+#define ECOSYSTEM_PROFILE_THREAD(name) ((void)0)
+#endif
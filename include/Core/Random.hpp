@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+namespace Random {
+
+// 🎲 GÉNÉRATEUR PAR COMPTEUR (Philox4x32-10)
+// Fonction pure de (clé, compteur) : aucun état par entité, tirages
+// reproductibles et indépendants de l'ordre d'évaluation.
+using Block = std::array<uint32_t, 4>;
+
+// 🔀 Flux logiques, pour que deux usages d'un même tick ne se recouvrent pas
+enum class Stream : uint32_t {
+    SPAWN = 0,   // Direction initiale à la naissance
+    TICK = 1     // Tirages de mouvement et de reproduction d'un tick
+};
+
+inline Block Philox4x32(Block counter, uint64_t key) {
+    uint32_t key0 = static_cast<uint32_t>(key);
+    uint32_t key1 = static_cast<uint32_t>(key >> 32);
+    for (int round = 0; round < 10; ++round) {
+        uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+        uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+        counter = {
+            static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+            static_cast<uint32_t>(product1),
+            static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+            static_cast<uint32_t>(product0)
+        };
+        key0 += 0x9E3779B9u;
+        key1 += 0xBB67AE85u;
+    }
+    return counter;
+}
+
+// 📐 Conversion en flottant uniforme dans [0, 1) (24 bits de mantisse)
+inline float ToUniform(uint32_t bits) {
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// 🎯 Quatre uniformes pour (graine, entité, tick, flux)
+inline std::array<float, 4> Uniforms(uint64_t seed, uint64_t entityId, uint64_t tick, Stream stream) {
+    Block bits = Philox4x32({static_cast<uint32_t>(entityId), static_cast<uint32_t>(entityId >> 32),
+                             static_cast<uint32_t>(tick), static_cast<uint32_t>(stream)},
+                            seed);
+    return {ToUniform(bits[0]), ToUniform(bits[1]), ToUniform(bits[2]), ToUniform(bits[3])};
+}
+
+// 📦 API PAR LOTS - quatre uniformes par entité pour tout un tableau d'identifiants
+void FillUniforms(uint64_t seed, const uint64_t* entityIds, std::size_t count,
+                  uint64_t tick, Stream stream, std::array<float, 4>* out);
+
+} // namespace Random
+} // namespace Core
+} // namespace Ecosystem
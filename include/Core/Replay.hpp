@@ -0,0 +1,108 @@
+#pragma once
+#include "Ecosystem.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+namespace Replay {
+
+// 🎬 ENREGISTREMENT ET REJEU DÉTERMINISTES
+// Une simulation ne dépend que de sa configuration (graine, pas de temps
+// fixe, monde, population ou instantané de départ) et des commandes reçues
+// entre deux ticks. Le journal contient la configuration puis, dans l'ordre,
+// un marqueur par tick (avec l'empreinte de l'état tous les N ticks) et les
+// commandes : le tick d'une commande est le nombre de marqueurs qui la
+// précèdent. Rejouer ce journal, dans ce build ou un autre, doit reproduire
+// chaque empreinte ; la première différence désigne le tick fautif.
+
+// ⌨️ COMMANDES QUI MODIFIENT LA SIMULATION
+// Pause, vitesse, turbo et caméra ne changent que le nombre de ticks par
+// image ou l'affichage : ils ne sont pas enregistrés.
+enum class Command : uint8_t {
+    RESET = 0,          // Population initiale de la configuration
+    SPAWN_FOOD = 1,     // amount unités à des positions aléatoires
+    LOAD_SNAPSHOT = 2   // Le fichier doit encore exister au rejeu
+};
+
+struct Input {
+    uint64_t tick;  // Nombre de ticks simulés avant la commande
+    Command command;
+    uint32_t amount;
+    std::string path;
+};
+
+// ⚙️ CONFIGURATION D'UNE SIMULATION
+struct RunConfig {
+    uint32_t seed = kDefaultSeed;
+    float deltaTime = 0.1f;
+    float worldWidth = 1200.0f;
+    float worldHeight = 800.0f;
+    int32_t maxEntities = 500;
+    std::array<int32_t, kSpeciesCount> population = {20, 5, 30};
+    std::string loadPath;       // Instantané de départ (sinon population initiale)
+    uint32_t hashInterval = 1;  // Empreinte tous les N ticks
+};
+
+// ▶️ DÉPART ET COMMANDES - les mêmes fonctions servent à l'enregistrement et au rejeu
+bool Start(Ecosystem& ecosystem, const RunConfig& config);
+bool Apply(Ecosystem& ecosystem, const RunConfig& config, const Input& input);
+
+// ⏺️ ENREGISTREUR
+class Recorder {
+private:
+    std::ofstream mFile;
+    std::string mPath;
+    uint64_t mTick;
+    uint32_t mHashInterval;
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    Recorder();
+    ~Recorder();
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    // 💾 FICHIER
+    bool Open(const std::string& path, const RunConfig& config);
+    void Close();
+    bool IsOpen() const { return mFile.is_open(); }
+
+    // 📝 ENREGISTREMENT - commande avant le tick suivant, tick après chaque Ecosystem::Update
+    void RecordInput(Command command, uint32_t amount = 0, const std::string& path = "");
+    void RecordTick(const Ecosystem& ecosystem);
+
+    // 📊 GETTERS
+    uint64_t GetTick() const { return mTick; }
+};
+
+// 📖 JOURNAL RELU
+struct Log {
+    RunConfig config;
+    std::vector<Input> inputs;
+    std::vector<std::pair<uint64_t, uint64_t>> hashes;  // (tick, empreinte après ce tick)
+    uint64_t ticks = 0;
+};
+
+bool Load(const std::string& path, Log& log);
+
+// ⏩ REJEU sans fenêtre, aussi vite que possible ; s'arrête à la première divergence
+struct Result {
+    uint64_t ticks = 0;  // Ticks rejoués
+    bool diverged = false;
+    uint64_t divergentTick = 0;
+    uint64_t expectedHash = 0;
+    uint64_t actualHash = 0;
+    double seconds = 0.0;
+};
+
+bool Run(const Log& log, std::size_t threadCount, Result& result);
+
+} // namespace Replay
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔄 FILE CIRCULAIRE BORNÉE SANS VERROU - plusieurs producteurs, un consommateur
+// Chaque case porte un numéro de séquence qui indique si elle est libre ou
+// remplie pour le tour courant : les producteurs réservent une case par CAS,
+// le consommateur la libère en avançant sa séquence d'un tour complet.
+template <typename T>
+class MpscRingBuffer {
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    // 🔒 STOCKAGE
+    std::unique_ptr<Cell[]> mCells;
+    uint64_t mMask;
+    alignas(64) std::atomic<uint64_t> mEnqueuePosition;
+    alignas(64) uint64_t mDequeuePosition;
+
+public:
+    // 🏗 CONSTRUCTEUR - capacité arrondie à la puissance de deux supérieure
+    explicit MpscRingBuffer(std::size_t capacity) : mEnqueuePosition(0), mDequeuePosition(0) {
+        std::size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mCells.reset(new Cell[size]);
+        mMask = size - 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // ➕ DÉPÔT (producteurs) - échoue si la file est pleine
+    bool TryPush(const T& value) {
+        uint64_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &mCells[position & mMask];
+            uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+            int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (difference == 0) {
+                if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ➖ RETRAIT (consommateur unique) - échoue si la file est vide
+    bool TryPop(T& value) {
+        Cell& cell = mCells[mDequeuePosition & mMask];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != mDequeuePosition + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(mDequeuePosition + mMask + 1, std::memory_order_release);
+        ++mDequeuePosition;
+        return true;
+    }
+
+    // 📊 GETTERS
+    std::size_t GetCapacity() const { return static_cast<std::size_t>(mMask + 1); }
+};
+
+} // namespace Core
+} // namespace Ecosystem
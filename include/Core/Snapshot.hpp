@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+namespace Snapshot {
+
+// 💾 FORMAT D'INSTANTANÉ BINAIRE (petit-boutiste, versionné)
+// [FileHeader][SectionEntry × sectionCount][sections alignées sur 64 octets]
+// Chaque section est un tableau brut d'éléments de taille fixe : le fichier
+// est projeté en mémoire (mmap) et chaque tableau est recopié d'un bloc,
+// sans analyse élément par élément. Les sections inconnues sont ignorées.
+static constexpr char kMagic[8] = {'E', 'C', 'O', 'S', 'N', 'A', 'P', '\0'};
+static constexpr uint32_t kVersion = 8;  // 2 : identifiants composés, noms attribués seulement
+                                         // 3 : entités rangées par espèce
+                                         // 4 : espèces paresseuses (TOUCH_TICK, LAZY)
+                                         // 5 : cumuls de naissances et de morts sur 64 bits
+                                         // 6 : STATISTICS en compteurs de largeur fixe
+                                         // 7 : cumuls retirés de l'en-tête, STATISTICS obligatoire
+                                         // 8 : cycle sur 64 bits
+static constexpr uint32_t kByteOrderMark = 0x01020304u;
+static constexpr std::size_t kSectionAlignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;  // kByteOrderMark tel qu'écrit par la machine d'origine
+    uint32_t sectionCount;
+    uint32_t reserved;
+    uint64_t fileSize;
+};
+
+struct SectionEntry {
+    uint32_t id;
+    uint32_t elementSize;
+    uint64_t count;
+    uint64_t offset;  // Depuis le début du fichier
+};
+
+// 🏷 IDENTIFIANTS DE SECTION - ne jamais renuméroter, seulement ajouter
+enum class Section : uint32_t {
+    ECOSYSTEM = 1,
+    RANDOM_GENERATOR = 2,
+    STATISTICS = 3,
+    SCHEDULE = 4,  // Horloge de la prochaine pousse de plante (facultative)
+
+    STORE = 10,
+    POSITION_X = 11,
+    POSITION_Y = 12,
+    VELOCITY_X = 13,
+    VELOCITY_Y = 14,
+    SPEED = 15,
+    ENERGY = 16,
+    METABOLISM = 17,
+    MAX_ENERGY = 18,
+    AGE = 19,
+    MAX_AGE = 20,
+    TYPE = 21,
+    ALIVE = 22,
+    UNIFORMS = 23,
+    SIZE = 24,
+    COLOR = 25,
+    NAME_OFFSETS = 26,     // Depuis la version 2, pour les seules entités de NAMED_IDS
+    NAME_CHARACTERS = 27,
+    ID = 28,
+    SLOT = 29,
+    SLOT_TO_INDEX = 30,
+    SLOT_GENERATION = 31,
+    FREE_SLOTS = 32,
+    SPECIES = 33,
+    NAMED_IDS = 34,
+    TOUCH_TICK = 35,
+    LAZY = 36,
+
+    FOOD = 40,
+    FOOD_UNITS = 41,
+    FOOD_REGROWTH = 42
+};
+
+// ✍️ ÉCRITURE - les tableaux sont référencés sans copie et doivent rester
+// valides jusqu'à WriteFile ; les petites valeurs sont copiées
+class Writer {
+private:
+    struct Pending {
+        Section id;
+        const void* data;
+        std::size_t elementSize;
+        std::size_t count;
+    };
+    std::vector<Pending> mSections;
+    std::vector<std::vector<char>> mOwnedData;
+
+public:
+    void Add(Section id, const void* data, std::size_t elementSize, std::size_t count);
+    void AddCopy(Section id, const void* data, std::size_t elementSize, std::size_t count);
+
+    template <typename T>
+    void AddArray(Section id, const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "section brute attendue");
+        Add(id, values.data(), sizeof(T), values.size());
+    }
+
+    template <typename T>
+    void AddValue(Section id, const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "section brute attendue");
+        AddCopy(id, &value, sizeof(T), 1);
+    }
+
+    // Écrit dans un fichier temporaire puis le renomme : un arrêt brutal
+    // ne laisse jamais d'instantané à moitié écrit
+    bool WriteFile(const std::string& path) const;
+};
+
+// 📖 LECTURE PAR PROJECTION EN MÉMOIRE
+class Reader {
+private:
+    void* mMapping;
+    std::size_t mSize;
+    const SectionEntry* mSections;
+    uint32_t mSectionCount;
+
+public:
+    Reader();
+    ~Reader();
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    // Valide l'en-tête et la table des sections
+    bool Open(const std::string& path);
+    void Close();
+
+    // nullptr si la section manque ou si la taille des éléments ne correspond pas
+    const void* Find(Section id, std::size_t elementSize, std::size_t& count) const;
+
+    template <typename T>
+    bool ReadArray(Section id, std::vector<T>& out) const {
+        static_assert(std::is_trivially_copyable<T>::value, "section brute attendue");
+        std::size_t count = 0;
+        const void* data = Find(id, sizeof(T), count);
+        if (!data) return false;
+        out.resize(count);
+        if (count > 0) {
+            std::memcpy(out.data(), data, count * sizeof(T));
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool ReadValue(Section id, T& out) const {
+        static_assert(std::is_trivially_copyable<T>::value, "section brute attendue");
+        std::size_t count = 0;
+        const void* data = Find(id, sizeof(T), count);
+        if (!data || count != 1) return false;
+        std::memcpy(&out, data, sizeof(T));
+        return true;
+    }
+};
+
+} // namespace Snapshot
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,80 @@
+#pragma once
+#include "Structs.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 INDEX SPATIAL PAR GRILLE UNIFORME
+// Les points sont insérés puis triés par cellule (tri par comptage) lors de
+// Build() : les requêtes ne parcourent que les cellules couvertes par le
+// rayon recherché, ce qui borne le coût par agent.
+class SpatialGrid {
+public:
+    // 📍 Point indexé (identifiant fourni par l'appelant + position)
+    struct Entry {
+        uint32_t id;
+        float x;
+        float y;
+    };
+
+    // 🎯 Résultat d'une requête de voisinage
+    struct Neighbor {
+        uint32_t id;
+        float x;
+        float y;
+        float distanceSquared;
+    };
+
+private:
+    // 🔒 GÉOMÉTRIE DE LA GRILLE
+    float mCellSize;
+    float mInverseCellSize;
+    int mColumns;
+    int mRows;
+
+    // 🗄 DONNÉES TRIÉES PAR CELLULE
+    std::vector<uint32_t> mCellStart;   // mColumns * mRows + 1 bornes
+    std::vector<Entry> mEntries;        // triées par cellule après Build()
+    std::vector<Entry> mPending;        // insertions en attente du prochain Build()
+    std::vector<uint32_t> mPendingCell;
+    std::vector<uint32_t> mCellCursor;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    SpatialGrid(float width, float height, float cellSize);
+
+    // ⚙️ CONSTRUCTION DE L'INDEX
+    void Resize(float width, float height, float cellSize);
+    void Clear();
+    void Insert(uint32_t id, float x, float y);
+    void Build();
+
+    // 🔍 REQUÊTES
+    // Tous les points à moins de `radius`, au plus `maxResults`, renvoie le nombre trouvé
+    std::size_t QueryRadius(Vector2D center, float radius, Neighbor* out, std::size_t maxResults) const;
+    // Les `k` points les plus proches à moins de `maxRadius`, triés par distance croissante
+    std::size_t QueryNearest(Vector2D center, std::size_t k, float maxRadius, Neighbor* out) const;
+    // Cellules couvertes par un rectangle, bornes comprises et ramenées dans la grille
+    void GetCellRange(float left, float top, float right, float bottom,
+                      int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const;
+    // Points d'une cellule, contigus après Build()
+    const Entry* GetCellBegin(int column, int row) const;
+    const Entry* GetCellEnd(int column, int row) const;
+
+    // 📊 GETTERS
+    std::size_t GetCount() const { return mEntries.size(); }
+    float GetCellSize() const { return mCellSize; }
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+
+private:
+    // 🔐 MÉTHODES PRIVÉES
+    int CellColumn(float x) const;
+    int CellRow(float y) const;
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,117 @@
+#pragma once
+#include "Structs.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🎯 ÉNUMÉRATION DES TYPES D'ENTITÉS
+// Les valeurs sont contiguës à partir de 0 : elles indexent les tableaux par espèce
+// et fixent l'ordre des partitions de l'EntityStore.
+enum class EntityType : uint8_t {
+    HERBIVORE,
+    CARNIVORE,
+    PLANT
+};
+
+static constexpr std::size_t kSpeciesCount = 3;
+
+// 🧬 PARAMÈTRES D'UNE ESPÈCE - appliqués à chaque nouvelle entité de ce type,
+// modifiables à l'exécution (balayages de paramètres)
+struct SpeciesParameters {
+    float initialEnergy;
+    float maxEnergy;
+    float metabolism;          // Énergie consommée par seconde (négative : production)
+    int32_t maxAge;
+    float size;
+    float reproductionChance;  // Probabilité par tick, une fois l'entité apte
+    Color color;
+};
+
+// 🧬 TRAITS D'ESPÈCE - connus à la compilation
+// kDefaults : valeurs initiales des paramètres (modifiables ensuite à l'exécution).
+// kName : nom affiché ; kKey : clé en minuscules des fichiers de balayage et
+// des colonnes de télémétrie.
+// Les comportements, eux, sont fixés ici : chaque boucle de simulation est
+// instanciée par espèce et le compilateur élimine le code qui ne la concerne pas.
+//   kMobile          se déplace (direction, mouvement et son coût, orientation)
+//   kGrazer          broute le champ de nourriture, le cherche et fuit les prédateurs
+//   kPredator        visible des proies dans l'index des prédateurs
+//   kEnergyPerTick   énergie produite à chaque tick (photosynthèse)
+//   kLazy            énergie et âge évalués en forme close, à la demande : l'espèce
+//                    sort des boucles par tick, ses morts et reproductions sont
+//                    planifiées d'avance (immobile, sans interaction seulement)
+// Ajouter une espèce : une valeur d'EntityType, kSpeciesCount et une spécialisation.
+template <EntityType Type>
+struct SpeciesTraits;
+
+template <>
+struct SpeciesTraits<EntityType::HERBIVORE> {
+    static constexpr const char* kName = "Herbivore";
+    static constexpr const char* kKey = "herbivore";
+    static constexpr SpeciesParameters kDefaults = {80.0f, 150.0f, 1.5f, 200, 8.0f, 0.3f, Color::Blue()};
+    static constexpr bool kMobile = true;
+    static constexpr bool kGrazer = true;
+    static constexpr bool kPredator = false;
+    static constexpr float kEnergyPerTick = 0.0f;
+    static constexpr bool kLazy = false;
+};
+
+template <>
+struct SpeciesTraits<EntityType::CARNIVORE> {
+    static constexpr const char* kName = "Carnivore";
+    static constexpr const char* kKey = "carnivore";
+    static constexpr SpeciesParameters kDefaults = {100.0f, 200.0f, 2.0f, 150, 12.0f, 0.3f, Color::Red()};
+    static constexpr bool kMobile = true;
+    static constexpr bool kGrazer = false;
+    static constexpr bool kPredator = true;
+    static constexpr float kEnergyPerTick = 0.0f;
+    static constexpr bool kLazy = false;
+};
+
+template <>
+struct SpeciesTraits<EntityType::PLANT> {
+    static constexpr const char* kName = "Plant";
+    static constexpr const char* kKey = "plant";
+    // Les plantes génèrent de l'énergie !
+    static constexpr SpeciesParameters kDefaults = {50.0f, 100.0f, -0.5f, 300, 6.0f, 0.3f, Color::Green()};
+    static constexpr bool kMobile = false;
+    static constexpr bool kGrazer = false;
+    static constexpr bool kPredator = false;
+    static constexpr float kEnergyPerTick = 0.1f;
+    static constexpr bool kLazy = true;
+};
+
+// 🏷 ÉTIQUETTE D'ESPÈCE - une valeur d'EntityType portée par le type
+template <EntityType Type>
+using SpeciesTag = std::integral_constant<EntityType, Type>;
+
+template <typename Tag>
+using TraitsOf = SpeciesTraits<Tag::value>;
+
+// 🔁 POUR CHAQUE ESPÈCE, dans l'ordre d'EntityType : function(SpeciesTag<...>())
+template <typename Function, std::size_t... Indices>
+void ForEachSpecies(Function&& function, std::index_sequence<Indices...>) {
+    (function(SpeciesTag<static_cast<EntityType>(Indices)>()), ...);
+}
+
+template <typename Function>
+void ForEachSpecies(Function&& function) {
+    ForEachSpecies(function, std::make_index_sequence<kSpeciesCount>());
+}
+
+// 📋 VALEURS DES TRAITS À L'EXÉCUTION
+const std::array<SpeciesParameters, kSpeciesCount>& DefaultSpeciesTable();
+SpeciesParameters DefaultSpecies(EntityType type);
+const char* SpeciesName(EntityType type);
+const char* SpeciesKey(EntityType type);
+bool IsLazySpecies(EntityType type);
+bool IsPredatorSpecies(EntityType type);
+float SpeciesEnergyPerTick(EntityType type);
+
+} // namespace Core
+} // namespace Ecosystem
@@ -35,25 +35,15 @@ struct Color {
     uint8_t a;
 
     // 🏗 Constructeurs multiples
-    Color() : r(255), g(255), b(255), a(255) {}  // Blanc par défaut
-    Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)
+    constexpr Color() : r(255), g(255), b(255), a(255) {}  // Blanc par défaut
+    constexpr Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)
         : r(red), g(green), b(blue), a(alpha) {}
 
     // 🎨 Couleurs prédéfinies
-    static Color Red() { return Color(255, 0, 0); }
-    static Color Green() { return Color(0, 255, 0); }
-    static Color Blue() { return Color(0, 0, 255); }
-    static Color Yellow() { return Color(255, 255, 0); }
-};
-
-struct Food {
-    Vector2D position;
-    float energyValue;
-    Color color;
-    
-    // 🏗 Constructeur
-    Food(Vector2D pos, float energy = 25.0f) 
-        : position(pos), energyValue(energy), color(Color::Green()) {}
+    static constexpr Color Red() { return Color(255, 0, 0); }
+    static constexpr Color Green() { return Color(0, 255, 0); }
+    static constexpr Color Blue() { return Color(0, 0, 255); }
+    static constexpr Color Yellow() { return Color(255, 255, 0); }
 };
 
 } // namespace Core
@@ -0,0 +1,103 @@
+#pragma once
+#include "Ecosystem.hpp"
+#include "RingBuffer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+namespace Telemetry {
+
+// 📈 SÉRIE TEMPORELLE DES STATISTIQUES
+// Un échantillon par tick (ou tous les N ticks) est conservé dans un
+// historique circulaire de taille fixe et, si un fichier est ouvert,
+// transmis à un thread d'écriture via une file sans verrou. Le fichier est
+// colonnaire : [en-tête][blocs], chaque bloc contenant ses lignes colonne
+// par colonne, ce qui se compresse et se relit très vite.
+static constexpr std::size_t kLifeStageBuckets = 8;  // Répartition de age / maxAge en huitièmes
+
+struct Sample {
+    uint64_t tick;
+    uint32_t herbivores;
+    uint32_t carnivores;
+    uint32_t plants;
+    uint32_t births;   // Pendant ce tick
+    uint32_t deaths;   // Pendant ce tick
+    float food;        // Unités de nourriture
+    float meanEnergy[kSpeciesCount];  // Herbivores, carnivores, plantes
+    uint32_t lifeStage[kLifeStageBuckets];
+    float phaseMicroseconds[kPhaseCount];
+    float tickMicroseconds;
+};
+
+// 🏷 DESCRIPTION DES COLONNES (ordre du fichier et du CSV)
+enum class ColumnType : uint8_t {
+    U32 = 0,
+    U64 = 1,
+    F32 = 2
+};
+
+struct Column {
+    std::string name;
+    ColumnType type;
+    std::size_t offset;  // Dans Sample
+};
+
+const std::vector<Column>& GetColumns();
+
+// 📸 CAPTURE - un parcours des entités, après Ecosystem::Update
+Sample Capture(const Ecosystem& ecosystem);
+
+// 🎥 ENREGISTREUR
+class Recorder {
+private:
+    // 🔄 HISTORIQUE EN MÉMOIRE (les plus anciens sont écrasés)
+    std::vector<Sample> mHistory;
+    std::size_t mHistoryNext;
+    std::size_t mHistorySize;
+    int mInterval;
+    uint64_t mTicksSinceSample;
+
+    // 💾 FLUX VERS LE FICHIER
+    MpscRingBuffer<Sample> mQueue;
+    std::ofstream mFile;
+    std::thread mWriterThread;
+    std::atomic<bool> mWriting;
+
+    void WriterLoop();
+    void WriteBlock(const std::vector<Sample>& block);
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    explicit Recorder(std::size_t historyCapacity = 4096);
+    ~Recorder();
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    // 💾 Démarre le flux vers un fichier binaire colonnaire
+    bool Open(const std::string& path);
+    void Close();  // Vide la file puis ferme le fichier
+
+    // ⚙️ Un échantillon tous les `ticks` appels à Record (1 par défaut)
+    void SetInterval(int ticks) { mInterval = ticks > 0 ? ticks : 1; }
+
+    // 📸 À appeler après chaque Ecosystem::Update
+    void Record(const Ecosystem& ecosystem);
+    void Record(const Sample& sample);
+
+    // 📊 HISTORIQUE - 0 = échantillon le plus récent
+    std::size_t GetHistorySize() const { return mHistorySize; }
+    const Sample& GetHistory(std::size_t age) const;
+};
+
+// 📄 EXPORT CSV d'un fichier colonnaire
+bool ExportCsv(const std::string& binaryPath, const std::string& csvPath);
+
+} // namespace Telemetry
+} // namespace Core
+} // namespace Ecosystem
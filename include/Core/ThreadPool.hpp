@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧵 POOL DE THREADS À VOL DE TÂCHES
+// Chaque travailleur possède sa propre file : il dépile ses tâches par
+// l'arrière et, une fois à court, vole celles des autres par l'avant.
+// Le thread appelant participe au travail en tant que travailleur 0.
+class ThreadPool {
+public:
+    // Corps d'une boucle parallèle : [begin, end) et indice du travailleur
+    using RangeFunction = std::function<void(std::size_t begin, std::size_t end, std::size_t worker)>;
+
+private:
+    // 📦 Tâche : un intervalle d'indices et la boucle à laquelle il appartient
+    struct Task {
+        std::size_t begin;
+        std::size_t end;
+        const RangeFunction* function;
+    };
+
+    // 📥 File d'un travailleur : les tâches sont toutes déposées avant le
+    // début du travail, [head, tasks.size()) reste donc à traiter
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::vector<Task> tasks;
+        std::size_t head = 0;
+    };
+
+    // 🔒 ÉTAT DU POOL
+    std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+    std::vector<std::thread> mThreads;
+    std::atomic<std::size_t> mPendingTasks;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    uint64_t mGeneration;
+    bool mStopping;
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR (0 = nombre de cœurs disponibles)
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // ⚙️ BOUCLE PARALLÈLE - découpe [0, count) en blocs de `grain` indices
+    // et ne rend la main qu'une fois tous les blocs traités
+    void ParallelFor(std::size_t count, std::size_t grain, const RangeFunction& function);
+
+    // 📊 GETTERS
+    std::size_t GetThreadCount() const { return mQueues.size(); }
+
+private:
+    // 🔐 MÉTHODES PRIVÉES
+    void WorkerLoop(std::size_t worker);
+    bool RunOneTask(std::size_t worker);
+    bool PopTask(std::size_t worker, Task& task);
+    bool StealTask(std::size_t thief, Task& task);
+};
+
+} // namespace Core
+} // namespace Ecosystem
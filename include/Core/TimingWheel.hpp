@@ -0,0 +1,66 @@
+#pragma once
+#include "EntityStore.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// ⏰ ÉVÉNEMENTS DATÉS DE LA SIMULATION
+enum class EventKind : uint8_t {
+    DEATH,          // Âge maximal atteint (faim aussi pour les espèces paresseuses)
+    REPRODUCTION,   // Espèce paresseuse : tirage de reproduction réussi, aptitude comprise
+    PLANT_SPAWN     // Pousse d'une nouvelle plante (sans entité)
+};
+
+struct TimedEvent {
+    uint64_t tick;
+    EntityHandle handle;
+    EventKind kind;
+};
+
+// ⏲ ROUE TEMPORELLE HIÉRARCHIQUE
+// kLevels niveaux de kSlots cases : une case du niveau k couvre kSlots^k
+// ticks. Un événement est rangé au niveau du premier octet où son tick
+// diffère du tick courant ; quand le tick courant atteint sa case, il
+// redescend d'un niveau. Planifier coûte O(1), avancer d'un tick O(1) amorti
+// plus les événements échus. Au-delà de 2^32 ticks, liste de débordement.
+// Aucune annulation explicite : l'appelant reconnaît et ignore un événement
+// périmé (poignée qui ne se résout plus, échéance recalculée différente).
+class TimingWheel {
+public:
+    static constexpr unsigned kSlotBits = 8;
+    static constexpr std::size_t kSlots = std::size_t(1) << kSlotBits;
+    static constexpr std::size_t kLevels = 4;
+
+private:
+    std::array<std::vector<TimedEvent>, kSlots * kLevels> mSlots;
+    std::vector<TimedEvent> mOverflow;
+    std::vector<TimedEvent> mCascade;  // Tampon de redescente
+    uint64_t mNow;                     // Dernier tick tiré
+    std::size_t mSize;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    explicit TimingWheel(uint64_t now = 0);
+
+    // ⚙️ MÉTHODES PUBLIQUES
+    void Reset(uint64_t now);  // Vide la roue, dont le prochain tick tiré sera now + 1
+    void Schedule(const TimedEvent& event);  // Un tick déjà tiré est ramené au suivant
+    // Avance jusqu'à now inclus et ajoute à due les événements échus, dans l'ordre des ticks
+    void Advance(uint64_t now, std::vector<TimedEvent>& due);
+
+    // 📊 GETTERS
+    uint64_t GetNow() const { return mNow; }
+    std::size_t Size() const { return mSize; }
+    bool Empty() const { return mSize == 0; }
+
+private:
+    void Place(const TimedEvent& event);
+    void Cascade(std::vector<TimedEvent>& slot);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,107 @@
+#pragma once
+#include "../Core/Ecosystem.hpp"
+#include "../Core/Profiler.hpp"
+#include "../Core/Replay.hpp"
+#include "../Core/Telemetry.hpp"
+#include "../Graphics/Camera.hpp"
+#include "../Graphics/Renderer.hpp"
+#include "../Graphics/Window.hpp"
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Engine {
+
+class GameEngine {
+private:
+    // 🔒 ÉTAT DU MOTEUR
+    Graphics::Window mWindow;
+    std::unique_ptr<Graphics::Renderer> mRenderer;
+    Core::Ecosystem mEcosystem;
+    uint32_t mSeed;
+    Core::Telemetry::Recorder mTelemetry;  // Historique récent des statistiques, en mémoire
+    Graphics::Camera mCamera;              // Le monde peut être bien plus grand que la fenêtre
+    std::array<int, Core::kSpeciesCount> mInitialPopulation;  // Initialisation et touche R
+    bool mIsRunning;
+    bool mIsPaused;
+    float mTimeScale;
+    
+    // ⏱ CHRONOMÉTRE
+    std::chrono::high_resolution_clock::time_point mLastUpdateTime;
+    float mAccumulatedTime;
+
+    // 🔁 PAS DE TEMPS FIXE
+    float mFixedTimeStep;       // Durée simulée d'un tick (secondes)
+    float mStepBudget;          // Temps processeur maximal par image pour la simulation (secondes)
+
+    // ⏩ MODE TURBO - simulation à pleine vitesse, affichage une image sur N
+    bool mTurboMode;
+    int mTurboPresentInterval;
+    int mFramesSinceRender;
+
+    // 💾 INSTANTANÉ UTILISÉ PAR F5 (sauvegarde) ET F9 (chargement)
+    std::string mSnapshotPath;
+    std::string mStartSnapshot;  // Chargé avant le début de l'enregistrement
+
+    // 🎬 ENREGISTREMENT POUR LE REJEU (--record)
+    Core::Replay::Recorder mReplay;
+
+    // ⏱ PROFILAGE - HUD (H) et trace Chrome (F12 démarre/arrête)
+    bool mShowHud;
+    std::vector<float> mFrameMilliseconds;  // Tampon circulaire des durées d'image
+    std::size_t mFrameNext;
+    Graphics::ProfilerHud mHud;
+    std::vector<Core::Profiler::Event> mTraceEvents;
+    std::string mTracePath;
+
+public:
+    // 🏗 CONSTRUCTEUR - fenêtre de width × height pixels, monde de worldWidth × worldHeight unités
+    GameEngine(const std::string& title, float width, float height,
+               float worldWidth, float worldHeight, int maxEntities = 500,
+               uint32_t seed = Core::kDefaultSeed);
+    
+    // ⚙️ MÉTHODES PRINCIPALES
+    bool Initialize();
+    void Run();
+    void Shutdown();
+    
+    // 🎮 GESTION D'ÉVÉNEMENTS
+    void HandleEvents();
+    void HandleInput(SDL_Keycode key);
+
+    // 🌱 POPULATION INITIALE (avant Initialize)
+    void SetInitialPopulation(int herbivores, int carnivores, int plants) {
+        mInitialPopulation = {herbivores, carnivores, plants};
+    }
+
+    // 🔧 CONFIGURATION DU PAS DE TEMPS
+    void SetFixedTimeStep(float step) { mFixedTimeStep = step; }
+    void SetStepBudget(float seconds) { mStepBudget = seconds; }
+    void SetTurboPresentInterval(int frames) { mTurboPresentInterval = frames > 0 ? frames : 1; }
+
+    // 💾 INSTANTANÉS
+    void SetSnapshotPath(const std::string& path) { mSnapshotPath = path; }
+    bool LoadSnapshot(const std::string& path);
+
+    // ⏱ TRACE
+    void SetTracePath(const std::string& path) { mTracePath = path; }
+
+    // 🎬 ENREGISTREMENT - après Initialize et l'éventuel instantané de départ
+    bool StartRecording(const std::string& path);
+
+private:
+    // 🔐 MÉTHODES INTERNES
+    int StepSimulation(float frameTime);
+    void Update(float deltaTime);
+    void Render();
+    void RenderUI();
+    void ToggleTrace();
+    void RecordFrameTime(float milliseconds);
+    bool ApplyCommand(Core::Replay::Command command, uint32_t amount = 0, const std::string& path = "");
+};
+
+} // namespace Engine
+} // namespace Ecosystem
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include "../Core/Structs.hpp"
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🎥 CAMÉRA - portion du monde affichée dans la fenêtre
+// Le monde et la fenêtre ont des tailles indépendantes : la caméra fixe le
+// point du monde au centre de l'écran et le zoom (pixels par unité du monde).
+// Le zoom minimal montre le monde entier ; le centre est ramené dans le
+// monde pour ne jamais afficher que du vide.
+// Ce module ne dépend pas de SDL.
+class Camera {
+private:
+    float mCenterX;
+    float mCenterY;
+    float mZoom;
+    float mViewportWidth;
+    float mViewportHeight;
+    float mWorldWidth;
+    float mWorldHeight;
+
+public:
+    static constexpr float kMaxZoom = 8.0f;
+
+    // 🏗 CONSTRUCTEUR - zoom 1 centré si le monde tient dans la fenêtre, monde entier sinon
+    Camera(float viewportWidth, float viewportHeight, float worldWidth, float worldHeight);
+
+    // ⚙️ CONFIGURATION
+    void SetWorld(float width, float height);
+    void SetViewport(float width, float height);
+    void Fit();  // Monde entier, centré
+
+    // 🕹 DÉPLACEMENTS, en pixels d'écran
+    void Pan(float screenDeltaX, float screenDeltaY);
+    void ZoomAt(float factor, float screenX, float screenY);  // Le point sous le curseur ne bouge pas
+
+    // 📐 CONVERSIONS
+    Core::Vector2D WorldToScreen(Core::Vector2D world) const;
+    Core::Vector2D ScreenToWorld(Core::Vector2D screen) const;
+
+    // 📊 GETTERS - rectangle visible en coordonnées du monde
+    float GetZoom() const { return mZoom; }
+    float GetMinZoom() const;
+    float GetLeft() const { return mCenterX - mViewportWidth / (2.0f * mZoom); }
+    float GetTop() const { return mCenterY - mViewportHeight / (2.0f * mZoom); }
+    float GetRight() const { return mCenterX + mViewportWidth / (2.0f * mZoom); }
+    float GetBottom() const { return mCenterY + mViewportHeight / (2.0f * mZoom); }
+    float GetViewportWidth() const { return mViewportWidth; }
+    float GetViewportHeight() const { return mViewportHeight; }
+
+private:
+    void Clamp();
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
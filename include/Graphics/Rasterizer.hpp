@@ -0,0 +1,64 @@
+#pragma once
+#include "../Core/Structs.hpp"
+#include "../Core/ThreadPool.hpp"
+#include "RenderBatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🖌 RASTÉRISEUR LOGICIEL - rendu hors écran, sans SDL ni carte graphique
+// Dessine un RenderBatch (rectangles alignés sur les axes) dans une image
+// RGB 8 bits en mémoire. L'image est découpée en tuiles de kTileSize pixels :
+// les rectangles sont d'abord répartis entre les tuiles qu'ils touchent
+// (par blocs consécutifs du lot, en parallèle), puis chaque tuile est
+// remplie par un seul thread, sans verrou, en respectant l'ordre du lot.
+// Un pixel est couvert si son centre est dans le rectangle, comme avec
+// SDL_RenderGeometry ; l'alpha est mélangé comme SDL_BLENDMODE_BLEND.
+class Rasterizer {
+public:
+    static constexpr int kTileSize = 64;
+    static constexpr std::size_t kRectsPerChunk = 4096;  // Grain de la répartition
+
+private:
+    // 📦 Rectangle en pixels entiers, bornes exclusives, déjà découpé à l'image
+    struct PixelRect {
+        int left, top, right, bottom;
+        uint8_t r, g, b, a;
+    };
+
+    int mWidth;
+    int mHeight;
+    int mTileColumns;
+    int mTileRows;
+    std::vector<uint8_t> mPixels;  // RGB, ligne par ligne
+    std::vector<PixelRect> mRects;
+    // Indices des rectangles de chaque tuile, par bloc du lot : [bloc * tuiles + tuile]
+    std::vector<std::vector<uint32_t>> mBins;
+    Core::ThreadPool mPool;
+
+public:
+    // 🏗 CONSTRUCTEUR (0 thread = nombre de cœurs disponibles)
+    Rasterizer(int width, int height, std::size_t threadCount = 0);
+
+    Rasterizer(const Rasterizer&) = delete;
+    Rasterizer& operator=(const Rasterizer&) = delete;
+
+    // 🎨 RENDU - fond uni puis le lot, dans l'ordre de ses rectangles
+    void Render(const RenderBatch& batch, const Core::Color& background = Core::Color(30, 30, 30));
+
+    // 📊 GETTERS
+    const std::vector<uint8_t>& GetPixels() const { return mPixels; }
+    int GetWidth() const { return mWidth; }
+    int GetHeight() const { return mHeight; }
+
+private:
+    void Bin(std::size_t chunk, const RenderBatch& batch);
+    void FillTile(int tile, std::size_t chunkCount, const Core::Color& background);
+    void FillOpaque(int left, int top, int right, int bottom, uint8_t r, uint8_t g, uint8_t b);
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,52 @@
+#pragma once
+#include "../Core/Ecosystem.hpp"
+#include "Camera.hpp"
+#include "SceneIndex.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 📐 SOMMET - même disposition mémoire que SDL_Vertex (position, couleur, texture)
+struct Vertex {
+    float x, y;
+    float r, g, b, a;
+    float u, v;
+};
+
+// 📦 LOT DE GÉOMÉTRIE
+// Toute la scène (nourriture, entités, barres d'énergie) est convertie en
+// rectangles pleins dans un seul tampon de sommets/indices, soumis ensuite
+// en un seul appel de dessin. Les tampons sont réutilisés d'une image à
+// l'autre et ne grandissent que lorsque la scène grandit.
+// Ce module ne dépend pas de SDL : il sert aussi aux rendus hors écran.
+class RenderBatch {
+private:
+    std::vector<Vertex> mVertices;
+    std::vector<int> mIndices;
+
+public:
+    // 🔍 En dessous de ce zoom, les entités sont remplacées par des tuiles de densité
+    static constexpr float kDensityZoom = 0.35f;
+    static constexpr float kMinTilePixels = 6.0f;  // Côté minimal d'une tuile de densité à l'écran
+
+    // ⚙️ CONSTRUCTION DU LOT
+    void Clear();
+    void AddRect(float x, float y, float width, float height, const Core::Color& color);
+    void AddEcosystem(const Core::Ecosystem& ecosystem);  // Monde entier, en coordonnées du monde
+    // Vue de la caméra, en pixels d'écran : seules les cellules visibles de
+    // l'index sont parcourues, le coût ne dépend pas de la population totale
+    void AddEcosystem(const Core::Ecosystem& ecosystem, const Camera& camera, const SceneIndex& index);
+
+    // 📊 GETTERS
+    const std::vector<Vertex>& GetVertices() const { return mVertices; }
+    const std::vector<int>& GetIndices() const { return mIndices; }
+    std::size_t GetRectCount() const { return mVertices.size() / 4; }
+
+private:
+    void AddDensityTiles(const Core::Ecosystem& ecosystem, const Camera& camera, const SceneIndex& index);
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
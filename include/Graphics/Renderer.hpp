@@ -2,22 +2,44 @@
 
 #include <SDL3/SDL.h>
 #include "../Core/Ecosystem.hpp"
+#include "Camera.hpp"
+#include "RenderBatch.hpp"
+#include "SceneIndex.hpp"
+#include <array>
+#include <vector>
 
 namespace Ecosystem
 {
     namespace Graphics
     {
 
+        // 📊 DONNÉES DU HUD DE PROFILAGE (préparées par le moteur)
+        struct ProfilerHud
+        {
+            std::vector<float> frameMilliseconds;                   // Du plus ancien au plus récent
+            std::array<float, Core::kPhaseCount> phaseMicroseconds; // Moyenne récente par phase du tick
+            float tickMicroseconds = 0.0f;
+            bool capturing = false;                                 // Trace en cours d'enregistrement
+        };
+
         class Renderer
         {
         private:
             SDL_Renderer *mRenderer;
+            RenderBatch mBatch;   // Réutilisé d'une image à l'autre
+            RenderBatch mOverlay; // Interface par-dessus la scène
+            SceneIndex mSceneIndex;
 
         public:
             Renderer(SDL_Renderer *renderer) : mRenderer(renderer) {}
 
+            // Rendu de la simulation : le cœur (Core) ne dépend pas de SDL
+            void RenderEcosystem(const Core::Ecosystem &ecosystem, const Camera &camera);
+            void InvalidateScene() { mSceneIndex.Invalidate(); } // Écosystème rechargé ou réinitialisé
             void RenderStatistics(const Core::Ecosystem::Statistics &stats);
+            void RenderProfilerHud(const ProfilerHud &hud);
+            void SubmitBatch(const RenderBatch &batch);
         };
 
     } // namespace Graphics
-} // namespace Ecosystem
\ No newline at end of file
+} // namespace Ecosystem
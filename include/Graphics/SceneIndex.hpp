@@ -0,0 +1,42 @@
+#pragma once
+#include "../Core/Ecosystem.hpp"
+#include "../Core/SpatialGrid.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🗺 INDEX SPATIAL DE LA SCÈNE - une grille par espèce
+// Permet au rendu de ne parcourir que les entités des cellules visibles, et
+// de compter les entités d'une zone sans les parcourir (tuiles de densité).
+// Reconstruit au plus une fois par tick simulé : entre deux ticks, les images
+// successives réutilisent le même index.
+class SceneIndex {
+public:
+    static constexpr float kCellSize = 64.0f;
+
+private:
+    std::vector<Core::SpatialGrid> mGrids;  // Indicées par EntityType
+    float mWorldWidth;
+    float mWorldHeight;
+    uint64_t mBuiltTick;
+    std::size_t mBuiltSize;
+    bool mValid;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    SceneIndex();
+
+    // ⚙️ MISE À JOUR - reconstruit si l'écosystème a avancé depuis la dernière fois
+    void Update(const Core::Ecosystem& ecosystem);
+    void Invalidate() { mValid = false; }  // Après un chargement ou une réinitialisation
+
+    // 📊 GETTERS
+    const Core::SpatialGrid& GetGrid(Core::EntityType type) const { return mGrids[static_cast<std::size_t>(type)]; }
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,77 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🎞 FORMATS DE FLUX VIDÉO NON COMPRESSÉS
+enum class VideoFormat {
+    Y4M,  // YUV4MPEG2, YCbCr 4:4:4 BT.601 : lu directement par ffmpeg, x264, mpv...
+    PPM   // Images P6 concaténées (ffmpeg -f image2pipe)
+};
+
+// 📼 ÉCRIVAIN DE FLUX VIDÉO
+// Les images RGB soumises sont copiées dans l'un des kBuffers tampons puis
+// converties et écrites par un thread dédié : la simulation n'attend
+// l'écriture que si l'encodeur en aval prend plus de kBuffers images de
+// retard. Destination : un fichier (ou un tube nommé) ou, si le chemin
+// commence par '|', l'entrée standard de la commande qui suit.
+class VideoWriter {
+public:
+    static constexpr std::size_t kBuffers = 3;
+
+private:
+    std::FILE* mFile;
+    bool mIsPipe;
+    std::string mPath;
+    VideoFormat mFormat;
+    int mWidth;
+    int mHeight;
+    uint64_t mFrames;
+
+    // 🔄 TAMPONS PARTAGÉS AVEC LE THREAD D'ÉCRITURE
+    std::vector<std::vector<uint8_t>> mFree;
+    std::deque<std::vector<uint8_t>> mPending;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::thread mWriterThread;
+    bool mStopping;
+    bool mFailed;
+
+    void WriterLoop();
+    bool WriteFrame(const std::vector<uint8_t>& rgb, std::vector<uint8_t>& planes);
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    VideoWriter();
+    ~VideoWriter();
+    VideoWriter(const VideoWriter&) = delete;
+    VideoWriter& operator=(const VideoWriter&) = delete;
+
+    // 💾 FLUX
+    bool Open(const std::string& path, int width, int height, VideoFormat format, int framesPerSecond = 30);
+    bool Close();  // Écrit les images en attente ; false si une écriture a échoué
+    bool IsOpen() const { return mFile != nullptr; }
+
+    // 🎞 IMAGE RGB de GetWidth() × GetHeight() pixels ; false si le flux est rompu
+    bool Submit(const std::vector<uint8_t>& rgb);
+
+    // 📊 GETTERS
+    uint64_t GetFrameCount() const { return mFrames; }
+    int GetWidth() const { return mWidth; }
+    int GetHeight() const { return mHeight; }
+
+    // 🔍 Format déduit de l'extension : .ppm, sinon Y4M
+    static VideoFormat FormatFromPath(const std::string& path);
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,410 @@
+#include "Core/Ecosystem.hpp"
+#include "Core/MotionKernel.hpp"
+#include "Graphics/Rasterizer.hpp"
+#include "Graphics/RenderBatch.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ⚙️ PARAMÈTRES DU BANC D'ESSAI
+struct BenchOptions {
+    int population = 100000;
+    int ticks = 200;
+    int warmupTicks = 10;
+    float deltaTime = 0.1f;
+    uint32_t seed = 42;
+    std::size_t maxThreads = 0;  // 0 = tous les cœurs
+    std::string mode = "suite";  // suite | scaling | kernels
+
+    // 📋 Suite de non-régression
+    std::size_t threads = 1;
+    int maxPopulation = 1000000;
+    std::string jsonPath = "bench_results.json";
+};
+
+using Clock = std::chrono::steady_clock;
+
+// 🔑 EMPREINTE DE L'ÉTAT (FNV-1a) - vérifie que le résultat ne dépend pas du nombre de threads
+template <typename T>
+static void HashArray(uint64_t& hash, const std::vector<T>& values) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values.data());
+    for (std::size_t i = 0; i < values.size() * sizeof(T); ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+}
+
+static uint64_t HashState(const Ecosystem::Core::EntityStore& entities) {
+    uint64_t hash = 1469598103934665603ull;
+    HashArray(hash, entities.id);
+    HashArray(hash, entities.positionX);
+    HashArray(hash, entities.positionY);
+    HashArray(hash, entities.velocityX);
+    HashArray(hash, entities.velocityY);
+    HashArray(hash, entities.speed);
+    HashArray(hash, entities.energy);
+    HashArray(hash, entities.age);
+    HashArray(hash, entities.alive);
+    return hash;
+}
+
+// 📈 MISE À L'ÉCHELLE - ticks/s d'Ecosystem::Update selon le nombre de threads
+static void RunScalingBenchmark(const BenchOptions& options) {
+    std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t maxThreads = options.maxThreads ? options.maxThreads : hardwareThreads;
+
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    // Densité constante : le monde grandit avec la population
+    float side = std::sqrt(static_cast<float>(options.population) * 400.0f);
+    int herbivores = options.population * 4 / 10;
+    int carnivores = options.population / 10;
+    int plants = options.population - herbivores - carnivores;
+
+    double baseline = 0.0;
+    uint64_t referenceHash = 0;
+    std::cout << std::left << std::setw(10) << "threads" << std::setw(14) << "ticks/s"
+              << std::setw(10) << "speedup" << "hash" << std::endl;
+
+    for (std::size_t threads : threadCounts) {
+        Ecosystem::Core::Ecosystem ecosystem(side, side, options.population * 2, options.seed);
+        ecosystem.SetThreadCount(threads);
+        ecosystem.Initialize(herbivores, carnivores, plants);
+        for (int tick = 0; tick < options.warmupTicks; ++tick) {
+            ecosystem.Update(options.deltaTime);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < options.ticks; ++tick) {
+            ecosystem.Update(options.deltaTime);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        double ticksPerSecond = options.ticks / elapsed.count();
+        uint64_t hash = HashState(ecosystem.GetEntities());
+        if (threads == threadCounts.front()) {
+            baseline = ticksPerSecond;
+            referenceHash = hash;
+        }
+        std::cout << std::left << std::setw(10) << threads << std::setw(14) << ticksPerSecond
+                  << std::setw(10) << ticksPerSecond / baseline
+                  << std::hex << hash << std::dec
+                  << (hash == referenceHash ? "" : "  ❌ diverge du run série") << std::endl;
+    }
+}
+
+// 🧮 NOYAUX DE MOUVEMENT - débit de chaque chemin et comparaison bit à bit au scalaire
+static bool RunKernelBenchmark(const BenchOptions& options) {
+    using Ecosystem::Core::EntityStore;
+    using Ecosystem::Core::EntityType;
+    namespace Motion = Ecosystem::Core::Motion;
+    namespace Random = Ecosystem::Core::Random;
+
+    // Population mixte identique pour chaque chemin ; les morts restent en place
+    // pour que le masque de vie soit aussi exercé
+    EntityStore reference;
+    reference.SetSeed(options.seed);
+    reference.Reserve(static_cast<std::size_t>(options.population));
+    for (int i = 0; i < options.population; ++i) {
+        std::array<float, 4> spawn = Random::Uniforms(options.seed, static_cast<uint64_t>(i), 0, Random::Stream::SPAWN);
+        EntityType type = spawn[2] < 0.4f ? EntityType::HERBIVORE
+                        : spawn[2] < 0.5f ? EntityType::CARNIVORE : EntityType::PLANT;
+        std::size_t index = reference.Add(type, Ecosystem::Core::Vector2D(spawn[0] * 1000.0f, spawn[1] * 1000.0f));
+        reference.age[index] = static_cast<int>(spawn[3] * reference.maxAge[index]);
+    }
+
+    std::cout << std::left << std::setw(10) << "path" << std::setw(18) << "entités/s"
+              << std::setw(10) << "speedup" << "hash" << std::endl;
+
+    bool identical = true;
+    double baseline = 0.0;
+    uint64_t referenceHash = 0;
+    for (Motion::Path path : {Motion::Path::SCALAR, Motion::Path::SSE2, Motion::Path::AVX2}) {
+        if (!Motion::IsSupported(path)) {
+            std::cout << std::left << std::setw(10) << Motion::PathName(path) << "non supporté" << std::endl;
+            continue;
+        }
+
+        EntityStore store = reference;
+        std::chrono::duration<double> elapsed(0.0);
+        for (int tick = 0; tick < options.ticks; ++tick) {
+            store.SetTick(static_cast<uint64_t>(tick));
+            store.DrawTickUniforms(0, store.Size());
+            auto start = std::chrono::steady_clock::now();
+            Motion::Advance(path, store, 0, store.Size(), options.deltaTime);
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+
+        double entitiesPerSecond = static_cast<double>(store.Size()) * options.ticks / elapsed.count();
+        uint64_t hash = HashState(store);
+        if (path == Motion::Path::SCALAR) {
+            baseline = entitiesPerSecond;
+            referenceHash = hash;
+        }
+        identical = identical && hash == referenceHash;
+        std::cout << std::left << std::setw(10) << Motion::PathName(path) << std::setw(18) << entitiesPerSecond
+                  << std::setw(10) << entitiesPerSecond / baseline
+                  << std::hex << hash << std::dec
+                  << (hash == referenceHash ? "" : "  ❌ diverge du chemin scalaire") << std::endl;
+    }
+    return identical;
+}
+
+// 📋 SUITE DE NON-RÉGRESSION - résultats JSON comparables d'une version à l'autre
+// Chaque scénario utilise une graine fixe ; les durées sont la meilleure de
+// plusieurs répétitions pour limiter le bruit de la machine.
+struct SuiteResult {
+    std::string name;
+    int entities;
+    std::string metric;  // Nom de la mesure principale (plus grand = mieux)
+    double value;
+    std::vector<std::pair<std::string, double>> details;
+};
+
+static int Repetitions(long long workPerRun) {
+    // Environ 2e7 opérations élémentaires par scénario, de 1 à 50 répétitions
+    return static_cast<int>(std::clamp(20000000LL / std::max(1LL, workPerRun), 1LL, 50LL));
+}
+
+static float WorldSide(int population) {
+    // Densité constante : le monde grandit avec la population
+    return std::sqrt(static_cast<float>(population) * 400.0f);
+}
+
+// 🔄 Ecosystem::Update complet, avec le détail de chaque phase
+static SuiteResult BenchmarkUpdate(const BenchOptions& options, int population) {
+    namespace Core = Ecosystem::Core;
+    const int ticks = population >= 1000000 ? 10 : 50;
+    const int repetitions = Repetitions(static_cast<long long>(population) * ticks);
+    float side = WorldSide(population);
+
+    double bestSeconds = 1e30;
+    std::vector<double> phaseSeconds(Core::kPhaseCount, 0.0);
+    std::size_t finalEntities = 0;
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        Core::Ecosystem ecosystem(side, side, population * 2, options.seed);
+        ecosystem.SetThreadCount(options.threads);
+        ecosystem.Initialize(population * 4 / 10, population / 10, population - population / 2);
+        for (int tick = 0; tick < options.warmupTicks; ++tick) {
+            ecosystem.Update(options.deltaTime);
+        }
+
+        std::vector<double> runPhases(Core::kPhaseCount, 0.0);
+        auto start = Clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            ecosystem.Update(options.deltaTime);
+            const Core::Ecosystem::TickReport& report = ecosystem.GetLastTick();
+            for (std::size_t phase = 0; phase < Core::kPhaseCount; ++phase) {
+                runPhases[phase] += report.phaseSeconds[phase];
+            }
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds < bestSeconds) {
+            bestSeconds = seconds;
+            phaseSeconds = runPhases;
+            finalEntities = ecosystem.GetEntities().Size();
+        }
+    }
+
+    SuiteResult result{"update", population, "ticks_per_second", ticks / bestSeconds, {}};
+    for (std::size_t phase = 0; phase < Core::kPhaseCount; ++phase) {
+        result.details.push_back({std::string("us_") + Core::PhaseName(static_cast<Core::Phase>(phase)),
+                                  phaseSeconds[phase] * 1e6 / ticks});
+    }
+    result.details.push_back({"final_entities", static_cast<double>(finalEntities)});
+    return result;
+}
+
+// ♻️ Naissances et morts en rafale : retrait O(1) et recyclage des emplacements
+static SuiteResult BenchmarkChurn(const BenchOptions& options, int population) {
+    namespace Core = Ecosystem::Core;
+    const long long operations = std::max(100000, population);
+    const int repetitions = Repetitions(operations * 4);
+
+    double bestSeconds = 1e30;
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        Core::EntityStore store;
+        store.SetSeed(options.seed);
+        store.Reserve(static_cast<std::size_t>(population));
+        for (int i = 0; i < population; ++i) {
+            store.Add(static_cast<Core::EntityType>(i % 3), Core::Vector2D(0.0f, 0.0f));
+        }
+
+        auto start = Clock::now();
+        for (long long operation = 0; operation < operations; ++operation) {
+            // Indice pseudo-aléatoire déterministe (générateur congruentiel)
+            std::size_t index = static_cast<std::size_t>((operation * 2654435761LL) % population);
+            store.RemoveAt(index);
+            store.Add(static_cast<Core::EntityType>(operation % 3), Core::Vector2D(1.0f, 1.0f));
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        bestSeconds = std::min(bestSeconds, seconds);
+    }
+    return {"churn", population, "operations_per_second", operations / bestSeconds,
+            {{"ns_per_spawn_and_destroy", bestSeconds * 1e9 / operations}}};
+}
+
+// 🎨 Construction du lot de géométrie d'une image (sans SDL ni fenêtre)
+static SuiteResult BenchmarkRenderBatch(const BenchOptions& options, int population) {
+    namespace Core = Ecosystem::Core;
+    float side = WorldSide(population);
+    Core::Ecosystem ecosystem(side, side, population * 2, options.seed);
+    ecosystem.Initialize(population * 4 / 10, population / 10, population - population / 2);
+    ecosystem.Update(options.deltaTime);
+
+    Ecosystem::Graphics::RenderBatch batch;
+    const int frames = std::max(3, 2000000 / population);
+    double bestSeconds = 1e30;
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = Clock::now();
+        batch.Clear();
+        batch.AddEcosystem(ecosystem);
+        bestSeconds = std::min(bestSeconds, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    std::size_t rects = batch.GetRectCount();
+
+    // Vue d'une fenêtre 1200 × 800 : zoom 1 au centre, puis monde entier (tuiles de densité)
+    Ecosystem::Graphics::SceneIndex index;
+    auto indexStart = Clock::now();
+    index.Update(ecosystem);
+    double indexSeconds = std::chrono::duration<double>(Clock::now() - indexStart).count();
+    Ecosystem::Graphics::Camera camera(1200.0f, 800.0f, side, side);
+    camera.ZoomAt(1.0f / camera.GetZoom(), 600.0f, 400.0f);
+    auto bestView = [&]() {
+        double best = 1e30;
+        for (int frame = 0; frame < 20; ++frame) {
+            auto start = Clock::now();
+            batch.Clear();
+            batch.AddEcosystem(ecosystem, camera, index);
+            best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        return best;
+    };
+    // Rendu logiciel du lot courant (export vidéo headless)
+    Ecosystem::Graphics::Rasterizer rasterizer(1200, 800, options.threads);
+    auto bestRaster = [&]() {
+        double best = 1e30;
+        for (int frame = 0; frame < 20; ++frame) {
+            auto start = Clock::now();
+            rasterizer.Render(batch);
+            best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        return best;
+    };
+    double viewSeconds = bestView();
+    std::size_t viewRects = batch.GetRectCount();
+    double viewRasterSeconds = bestRaster();
+    camera.Fit();
+    double fitSeconds = bestView();
+    double fitRasterSeconds = bestRaster();
+
+    return {"render_batch", population, "frames_per_second", 1.0 / bestSeconds,
+            {{"rects", static_cast<double>(rects)}, {"us_per_frame", bestSeconds * 1e6},
+             {"us_scene_index", indexSeconds * 1e6},
+             {"view_rects", static_cast<double>(viewRects)}, {"us_per_view_frame", viewSeconds * 1e6},
+             {"density_rects", static_cast<double>(batch.GetRectCount())},
+             {"us_per_density_frame", fitSeconds * 1e6},
+             {"us_per_view_raster", viewRasterSeconds * 1e6},
+             {"us_per_density_raster", fitRasterSeconds * 1e6}}};
+}
+
+// 📝 ÉCRITURE JSON
+static std::string JsonNumber(double value) {
+    if (!std::isfinite(value)) return "null";
+    std::ostringstream stream;
+    stream << std::setprecision(9) << value;
+    return stream.str();
+}
+
+static bool WriteSuiteJson(const BenchOptions& options, const std::vector<SuiteResult>& results) {
+    std::ofstream file(options.jsonPath);
+    if (!file) {
+        std::cerr << "❌ Impossible d'écrire " << options.jsonPath << std::endl;
+        return false;
+    }
+    file << "{\n";
+    file << "  \"seed\": " << options.seed << ",\n";
+    file << "  \"threads\": " << options.threads << ",\n";
+    file << "  \"delta_time\": " << JsonNumber(options.deltaTime) << ",\n";
+    file << "  \"motion_path\": \"" << Ecosystem::Core::Motion::PathName(Ecosystem::Core::Motion::GetActivePath()) << "\",\n";
+#ifdef __VERSION__
+    file << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+    file << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const SuiteResult& result = results[i];
+        file << "    {\"name\": \"" << result.name << "\", \"entities\": " << result.entities
+             << ", \"" << result.metric << "\": " << JsonNumber(result.value);
+        for (const auto& detail : result.details) {
+            file << ", \"" << detail.first << "\": " << JsonNumber(detail.second);
+        }
+        file << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+static bool RunSuite(const BenchOptions& options) {
+    std::vector<SuiteResult> results;
+    auto report = [&](SuiteResult result) {
+        std::cerr << "📋 " << std::left << std::setw(14) << result.name << std::setw(10) << result.entities
+                  << result.metric << " = " << result.value << std::endl;
+        results.push_back(std::move(result));
+    };
+
+    for (int population : {1000, 10000, 100000, 1000000}) {
+        if (population > options.maxPopulation) break;
+        report(BenchmarkUpdate(options, population));
+        report(BenchmarkChurn(options, population));
+        report(BenchmarkRenderBatch(options, population));
+    }
+    if (!WriteSuiteJson(options, results)) {
+        return false;
+    }
+    std::cerr << "✅ Résultats écrits dans " << options.jsonPath << std::endl;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--population") options.population = std::atoi(argv[i + 1]);
+        else if (arg == "--ticks") options.ticks = std::atoi(argv[i + 1]);
+        else if (arg == "--seed") options.seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (arg == "--max-threads") options.maxThreads = static_cast<std::size_t>(std::atoi(argv[i + 1]));
+        else if (arg == "--mode") options.mode = argv[i + 1];
+        else if (arg == "--threads") options.threads = static_cast<std::size_t>(std::atoi(argv[i + 1]));
+        else if (arg == "--max-population") options.maxPopulation = std::atoi(argv[i + 1]);
+        else if (arg == "--json") options.jsonPath = argv[i + 1];
+        else {
+            std::cerr << "❌ Option inconnue: " << arg << std::endl;
+            return -1;
+        }
+    }
+
+    if (options.mode == "suite") {
+        return RunSuite(options) ? 0 : 1;
+    }
+    if (options.mode == "kernels") {
+        return RunKernelBenchmark(options) ? 0 : 1;
+    }
+    if (options.mode != "scaling") {
+        std::cerr << "❌ Mode inconnu: " << options.mode << std::endl;
+        return -1;
+    }
+    RunScalingBenchmark(options);
+    return 0;
+}
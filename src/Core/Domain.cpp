@@ -0,0 +1,548 @@
+#include "Core/Domain.hpp"
+#include "Core/Ecosystem.hpp"
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Ecosystem {
+namespace Core {
+namespace Domain {
+
+// 🧭 LES HUIT VOISINES - une direction et son opposée ont des indices symétriques
+static constexpr int kDirections = 8;
+// Chaque tuile numérote ses entités à partir de index << kTileSerialBits
+static constexpr unsigned kTileSerialBits = 40;
+static constexpr int kMaxTiles = 1 << (kEntityIdSerialBits - kTileSerialBits);
+static constexpr int kOffsetX[kDirections] = {-1, 0, 1, -1, 1, -1, 0, 1};
+static constexpr int kOffsetY[kDirections] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+static int Opposite(int direction) {
+    return kDirections - 1 - direction;
+}
+
+static int DirectionOf(int dx, int dy) {
+    for (int direction = 0; direction < kDirections; ++direction) {
+        if (kOffsetX[direction] == dx && kOffsetY[direction] == dy) return direction;
+    }
+    return -1;
+}
+
+// 📐 GÉOMÉTRIE D'UNE TUILE (bornes calculées identiquement par les deux voisines)
+struct Tile {
+    int column;
+    int row;
+    float left;
+    float top;
+    float width;
+    float height;
+};
+
+static Tile MakeTile(const Config& config, int index) {
+    Tile tile;
+    tile.column = index % config.columns;
+    tile.row = index / config.columns;
+    tile.left = config.worldWidth * tile.column / config.columns;
+    tile.top = config.worldHeight * tile.row / config.rows;
+    tile.width = config.worldWidth * (tile.column + 1) / config.columns - tile.left;
+    tile.height = config.worldHeight * (tile.row + 1) / config.rows - tile.top;
+    return tile;
+}
+
+static int NeighborIndex(const Config& config, const Tile& tile, int direction) {
+    int column = tile.column + kOffsetX[direction];
+    int row = tile.row + kOffsetY[direction];
+    if (column < 0 || column >= config.columns || row < 0 || row >= config.rows) return -1;
+    return row * config.columns + column;
+}
+
+// 📦 MESSAGE ENTRE VOISINES : [taille][en-tête][migrants][noms][fantômes]
+// Les positions voyagent en coordonnées globales.
+struct MessageHeader {
+    uint64_t tick;
+    uint32_t migrantCount;
+    uint32_t nameBytes;
+    uint32_t ghostCount;
+    uint32_t reserved;
+};
+
+struct Ghost {
+    float x;
+    float y;
+};
+
+struct Outbox {
+    std::vector<Migrant> migrants;
+    std::vector<char> names;
+    std::vector<Ghost> ghosts;
+};
+
+// 🔌 CANAL NON BLOQUANT VERS UNE VOISINE
+// Envoi et réception progressent ensemble sous poll : deux voisines qui
+// s'envoient de gros messages en même temps ne peuvent pas s'interbloquer.
+struct Channel {
+    int fd = -1;
+    std::vector<char> outgoing;
+    std::size_t sent = 0;
+    std::vector<char> incoming;  // Taille (8 octets) puis corps du message
+    std::size_t received = 0;
+
+    bool SendPending() const { return sent < outgoing.size(); }
+    bool ReceiveComplete() const { return incoming.size() > sizeof(uint64_t) && received == incoming.size(); }
+};
+
+static void Encode(uint64_t tick, const Outbox& outbox, std::vector<char>& out) {
+    MessageHeader header = {tick, static_cast<uint32_t>(outbox.migrants.size()),
+                            static_cast<uint32_t>(outbox.names.size()),
+                            static_cast<uint32_t>(outbox.ghosts.size()), 0};
+    uint64_t bodySize = sizeof(header) + outbox.migrants.size() * sizeof(Migrant) +
+                        outbox.names.size() + outbox.ghosts.size() * sizeof(Ghost);
+    out.resize(sizeof(bodySize) + bodySize);
+    char* cursor = out.data();
+    auto append = [&cursor](const void* data, std::size_t bytes) {
+        if (bytes > 0) std::memcpy(cursor, data, bytes);
+        cursor += bytes;
+    };
+    append(&bodySize, sizeof(bodySize));
+    append(&header, sizeof(header));
+    append(outbox.migrants.data(), outbox.migrants.size() * sizeof(Migrant));
+    append(outbox.names.data(), outbox.names.size());
+    append(outbox.ghosts.data(), outbox.ghosts.size() * sizeof(Ghost));
+}
+
+static bool Decode(const std::vector<char>& message, uint64_t tick, Outbox& inbox) {
+    MessageHeader header;
+    std::size_t offset = sizeof(uint64_t);
+    if (message.size() < offset + sizeof(header)) return false;
+    std::memcpy(&header, message.data() + offset, sizeof(header));
+    offset += sizeof(header);
+    std::size_t expected = offset + header.migrantCount * sizeof(Migrant) + header.nameBytes +
+                           header.ghostCount * sizeof(Ghost);
+    if (header.tick != tick || message.size() != expected) return false;
+
+    inbox.migrants.resize(header.migrantCount);
+    inbox.names.resize(header.nameBytes);
+    inbox.ghosts.resize(header.ghostCount);
+    auto extract = [&](void* data, std::size_t bytes) {
+        if (bytes > 0) std::memcpy(data, message.data() + offset, bytes);
+        offset += bytes;
+    };
+    extract(inbox.migrants.data(), inbox.migrants.size() * sizeof(Migrant));
+    extract(inbox.names.data(), inbox.names.size());
+    extract(inbox.ghosts.data(), inbox.ghosts.size() * sizeof(Ghost));
+    return true;
+}
+
+// 🔁 UN MESSAGE ENVOYÉ ET UN MESSAGE REÇU SUR CHAQUE CANAL
+static bool Exchange(std::vector<Channel>& channels) {
+    for (Channel& channel : channels) {
+        channel.sent = 0;
+        channel.incoming.resize(sizeof(uint64_t));
+        channel.received = 0;
+    }
+
+    std::vector<pollfd> polled;
+    std::vector<Channel*> owners;
+    while (true) {
+        polled.clear();
+        owners.clear();
+        for (Channel& channel : channels) {
+            short events = 0;
+            if (channel.SendPending()) events |= POLLOUT;
+            if (!channel.ReceiveComplete()) events |= POLLIN;
+            if (events == 0) continue;
+            polled.push_back({channel.fd, events, 0});
+            owners.push_back(&channel);
+        }
+        if (polled.empty()) return true;
+
+        if (poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        for (std::size_t i = 0; i < polled.size(); ++i) {
+            Channel& channel = *owners[i];
+            short revents = polled[i].revents;
+            if ((revents & POLLOUT) && channel.SendPending()) {
+                ssize_t bytes = send(channel.fd, channel.outgoing.data() + channel.sent,
+                                     channel.outgoing.size() - channel.sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+                if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+                if (bytes > 0) channel.sent += static_cast<std::size_t>(bytes);
+            }
+            if ((revents & (POLLIN | POLLHUP | POLLERR)) && !channel.ReceiveComplete()) {
+                // Jamais au-delà du message courant : le suivant appartient au tick suivant
+                ssize_t bytes = recv(channel.fd, channel.incoming.data() + channel.received,
+                                     channel.incoming.size() - channel.received, MSG_DONTWAIT);
+                if (bytes == 0) return false;  // Voisine terminée
+                if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+                if (bytes > 0) channel.received += static_cast<std::size_t>(bytes);
+                if (channel.incoming.size() == sizeof(uint64_t) && channel.received == sizeof(uint64_t)) {
+                    uint64_t bodySize;
+                    std::memcpy(&bodySize, channel.incoming.data(), sizeof(bodySize));
+                    if (bodySize < sizeof(MessageHeader)) return false;
+                    channel.incoming.resize(sizeof(uint64_t) + bodySize);
+                }
+            }
+        }
+    }
+}
+
+// 📨 ÉCHANGES BLOQUANTS AVEC LE COORDINATEUR
+static bool WriteAll(int fd, const void* data, std::size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = send(fd, bytes, size, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+static bool ReadAll(int fd, void* data, std::size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t read = recv(fd, bytes, size, 0);
+        if (read < 0 && errno == EINTR) continue;
+        if (read <= 0) return false;
+        bytes += read;
+        size -= static_cast<std::size_t>(read);
+    }
+    return true;
+}
+
+// 🧩 PROCESSUS D'UNE TUILE - renvoie son code de sortie
+static int RunTile(const Config& config, int index, const std::array<int, kDirections>& links, int coordinator) {
+    const Tile tile = MakeTile(config, index);
+    const int tileCount = config.columns * config.rows;
+    auto share = [&](int total) {
+        return static_cast<int>(static_cast<long long>(total) * (index + 1) / tileCount -
+                                static_cast<long long>(total) * index / tileCount);
+    };
+
+    Ecosystem ecosystem(tile.width, tile.height, share(config.maxEntities),
+                        config.seed ^ (0x9E3779B9u * static_cast<uint32_t>(index + 1)), false);
+    ecosystem.SetThreadCount(config.threadsPerTile);
+    ecosystem.SetWorldBounds(Vector2D(-tile.left, -tile.top),
+                             Vector2D(config.worldWidth - tile.left, config.worldHeight - tile.top));
+    ecosystem.SetIdBase(static_cast<uint64_t>(index) << kTileSerialBits);
+    ecosystem.Initialize(share(config.herbivores), share(config.carnivores), share(config.plants));
+
+    // Au-delà d'un bord partagé, l'entité passe chez la voisine ; au bord du monde, elle reste
+    const float infinity = std::numeric_limits<float>::infinity();
+    bool hasWest = links[DirectionOf(-1, 0)] >= 0;
+    bool hasEast = links[DirectionOf(1, 0)] >= 0;
+    bool hasNorth = links[DirectionOf(0, -1)] >= 0;
+    bool hasSouth = links[DirectionOf(0, 1)] >= 0;
+    Vector2D keepMinimum(hasWest ? 0.0f : -infinity, hasNorth ? 0.0f : -infinity);
+    Vector2D keepMaximum(hasEast ? tile.width : infinity, hasSouth ? tile.height : infinity);
+
+    std::vector<Channel> channels;
+    std::array<int, kDirections> channelOf;
+    channelOf.fill(-1);
+    for (int direction = 0; direction < kDirections; ++direction) {
+        if (links[direction] < 0) continue;
+        channelOf[direction] = static_cast<int>(channels.size());
+        channels.emplace_back();
+        channels.back().fd = links[direction];
+    }
+
+    std::array<Outbox, kDirections> outboxes;
+    Outbox inbox;
+    std::vector<Migrant> emigrants;
+    std::vector<char> emigrantNames;
+    std::vector<Vector2D> ghosts;
+    const float radius = Entity::kPerceptionRadius;
+    float updateSeconds = 0.0f;
+
+    for (long long tick = 0;; ++tick) {
+        auto exchangeStart = std::chrono::steady_clock::now();
+        for (Outbox& outbox : outboxes) {
+            outbox.migrants.clear();
+            outbox.names.clear();
+            outbox.ghosts.clear();
+        }
+        ghosts.clear();
+
+        // 🧳 Migrants, routés selon le bord franchi
+        std::size_t nameOffset = 0;
+        for (Migrant migrant : emigrants) {
+            int dx = (migrant.positionX < 0.0f && hasWest) ? -1 : (migrant.positionX >= tile.width && hasEast) ? 1 : 0;
+            int dy = (migrant.positionY < 0.0f && hasNorth) ? -1 : (migrant.positionY >= tile.height && hasSouth) ? 1 : 0;
+            Outbox& outbox = outboxes[DirectionOf(dx, dy)];
+            // Un prédateur qui vient de partir reste visible ici jusqu'au prochain échange
+            if (IsPredatorSpecies(migrant.type)) {
+                ghosts.push_back(Vector2D(migrant.positionX, migrant.positionY));
+            }
+            migrant.positionX += tile.left;
+            migrant.positionY += tile.top;
+            outbox.migrants.push_back(migrant);
+            outbox.names.insert(outbox.names.end(), emigrantNames.begin() + nameOffset,
+                                emigrantNames.begin() + nameOffset + migrant.nameLength);
+            nameOffset += migrant.nameLength;
+        }
+
+        // 👻 Prédateurs proches d'un bord, pour chaque voisine concernée
+        const EntityStore& entities = ecosystem.GetEntities();
+        entities.ForEachSpeciesRange(0, entities.Size(), [&](auto species, std::size_t from, std::size_t to) {
+            if constexpr (TraitsOf<decltype(species)>::kPredator) {
+                for (std::size_t i = from; i < to; ++i) {
+                    if (!entities.alive[i]) continue;
+                    float x = entities.positionX[i];
+                    float y = entities.positionY[i];
+                    int dx = x < radius ? -1 : (x >= tile.width - radius ? 1 : 0);
+                    int dy = y < radius ? -1 : (y >= tile.height - radius ? 1 : 0);
+                    auto publish = [&](int ox, int oy) {
+                        int direction = DirectionOf(ox, oy);
+                        if (links[direction] >= 0) {
+                            outboxes[direction].ghosts.push_back({x + tile.left, y + tile.top});
+                        }
+                    };
+                    if (dx != 0) publish(dx, 0);
+                    if (dy != 0) publish(0, dy);
+                    if (dx != 0 && dy != 0) publish(dx, dy);
+                }
+            }
+        });
+
+        // 🔁 Échange avec toutes les voisines
+        for (int direction = 0; direction < kDirections; ++direction) {
+            if (channelOf[direction] >= 0) {
+                Encode(static_cast<uint64_t>(tick), outboxes[direction], channels[channelOf[direction]].outgoing);
+            }
+        }
+        if (!Exchange(channels)) {
+            std::cerr << "❌ Tuile " << index << ": échange interrompu au tick " << tick << std::endl;
+            return 1;
+        }
+        for (Channel& channel : channels) {
+            if (!Decode(channel.incoming, static_cast<uint64_t>(tick), inbox)) {
+                std::cerr << "❌ Tuile " << index << ": message invalide au tick " << tick << std::endl;
+                return 1;
+            }
+            for (Migrant& migrant : inbox.migrants) {
+                migrant.positionX -= tile.left;
+                migrant.positionY -= tile.top;
+            }
+            ecosystem.AddImmigrants(inbox.migrants, inbox.names);
+            for (const Ghost& ghost : inbox.ghosts) {
+                ghosts.push_back(Vector2D(ghost.x - tile.left, ghost.y - tile.top));
+            }
+        }
+        ecosystem.SetGhostPredators(ghosts);
+        float exchangeSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - exchangeStart).count();
+
+        // 📊 Bilan du tick précédent, populations après l'échange
+        if (tick > 0) {
+            const Ecosystem::TickReport& lastTick = ecosystem.GetLastTick();
+            TileReport report = {};
+            report.tick = static_cast<uint64_t>(tick);
+            for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+                report.population[species] = ecosystem.GetPopulation(static_cast<EntityType>(species));
+            }
+            report.births = lastTick.births;
+            report.deaths = lastTick.deaths;
+            report.emigrants = static_cast<uint32_t>(emigrants.size());
+            report.food = static_cast<float>(ecosystem.GetFoodField().GetTotalUnits());
+            report.updateSeconds = updateSeconds;
+            report.exchangeSeconds = exchangeSeconds;
+            if (!WriteAll(coordinator, &report, sizeof(report))) {
+                std::cerr << "❌ Tuile " << index << ": coordinateur injoignable" << std::endl;
+                return 1;
+            }
+        }
+        if (tick == config.ticks) break;
+
+        auto updateStart = std::chrono::steady_clock::now();
+        ecosystem.Update(config.deltaTime);
+        updateSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - updateStart).count();
+        emigrants.clear();
+        emigrantNames.clear();
+        ecosystem.ExtractEmigrants(keepMinimum, keepMaximum, emigrants, emigrantNames);
+    }
+    return 0;
+}
+
+static void CloseAll(std::vector<std::array<int, kDirections>>& links, std::vector<std::array<int, 2>>& reports) {
+    for (auto& tileLinks : links) {
+        for (int& fd : tileLinks) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+    }
+    for (auto& pair : reports) {
+        for (int& fd : pair) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+    }
+}
+
+// 🚀 COORDINATEUR
+bool Run(const Config& config, GlobalStatistics& statistics) {
+    statistics = GlobalStatistics();
+    if (config.columns < 1 || config.rows < 1) {
+        std::cerr << "❌ Découpage invalide: " << config.columns << "x" << config.rows << std::endl;
+        return false;
+    }
+    if (static_cast<long long>(config.columns) * config.rows > kMaxTiles) {
+        std::cerr << "❌ Trop de tuiles: " << config.columns << "x" << config.rows
+                  << " (au plus " << kMaxTiles << ")" << std::endl;
+        return false;
+    }
+    // Les bandes de fantômes des deux bords opposés ne doivent pas se chevaucher
+    if (config.worldWidth / config.columns < 2.0f * Entity::kPerceptionRadius ||
+        config.worldHeight / config.rows < 2.0f * Entity::kPerceptionRadius) {
+        std::cerr << "❌ Tuiles trop petites: au moins " << 2.0f * Entity::kPerceptionRadius
+                  << " unités de côté sont nécessaires" << std::endl;
+        return false;
+    }
+
+    // 🔌 Un socket par paire de voisines, un par tuile vers le coordinateur
+    const int tileCount = config.columns * config.rows;
+    std::vector<std::array<int, kDirections>> links(tileCount);
+    std::vector<std::array<int, 2>> reports(tileCount, std::array<int, 2>{-1, -1});
+    for (auto& tileLinks : links) tileLinks.fill(-1);
+    for (int index = 0; index < tileCount; ++index) {
+        Tile tile = MakeTile(config, index);
+        for (int direction = 0; direction < kDirections; ++direction) {
+            int neighbor = NeighborIndex(config, tile, direction);
+            if (neighbor <= index) continue;
+            int pair[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+                std::cerr << "❌ socketpair: " << std::strerror(errno) << std::endl;
+                CloseAll(links, reports);
+                return false;
+            }
+            links[index][direction] = pair[0];
+            links[neighbor][Opposite(direction)] = pair[1];
+        }
+        int pair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+            std::cerr << "❌ socketpair: " << std::strerror(errno) << std::endl;
+            CloseAll(links, reports);
+            return false;
+        }
+        reports[index] = {pair[0], pair[1]};
+    }
+
+    // 🍴 Une tuile par processus ; chacun ne garde que ses propres sockets
+    std::cout.flush();
+    std::cerr.flush();
+    std::vector<pid_t> children;
+    bool failed = false;
+    for (int index = 0; index < tileCount; ++index) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            std::cerr << "❌ fork: " << std::strerror(errno) << std::endl;
+            failed = true;
+            break;
+        }
+        if (pid == 0) {
+            std::array<int, kDirections> ownLinks = links[index];
+            int coordinator = reports[index][1];
+            for (int other = 0; other < tileCount; ++other) {
+                for (int direction = 0; direction < kDirections; ++direction) {
+                    if (other != index && links[other][direction] >= 0) close(links[other][direction]);
+                }
+                close(reports[other][0]);
+                if (other != index) close(reports[other][1]);
+            }
+            int code = RunTile(config, index, ownLinks, coordinator);
+            std::cout.flush();
+            std::cerr.flush();
+            _exit(code);  // Pas de destructeurs statiques hérités du parent
+        }
+        children.push_back(pid);
+    }
+    for (int index = 0; index < tileCount; ++index) {
+        for (int& fd : links[index]) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+        close(reports[index][1]);
+        reports[index][1] = -1;
+    }
+
+    // 📊 Agrégation, tick par tick
+    std::vector<TileReport> tileReports(tileCount);
+    std::vector<double> tileUpdateSeconds(tileCount, 0.0);
+    std::vector<double> tileExchangeSeconds(tileCount, 0.0);
+    for (long long tick = 1; !failed && tick <= config.ticks; ++tick) {
+        for (int index = 0; index < tileCount; ++index) {
+            if (!ReadAll(reports[index][0], &tileReports[index], sizeof(TileReport)) ||
+                tileReports[index].tick != static_cast<uint64_t>(tick)) {
+                std::cerr << "❌ Tuile " << index << " perdue au tick " << tick << std::endl;
+                failed = true;
+                break;
+            }
+        }
+        if (failed) break;
+
+        statistics.ticks = tick;
+        statistics.population = {};
+        statistics.food = 0.0;
+        const TileReport* slowest = &tileReports[0];
+        for (int index = 0; index < tileCount; ++index) {
+            const TileReport& report = tileReports[index];
+            for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+                statistics.population[species] += report.population[species];
+            }
+            statistics.births += report.births;
+            statistics.deaths += report.deaths;
+            statistics.migrations += report.emigrants;
+            statistics.food += report.food;
+            tileUpdateSeconds[index] += report.updateSeconds;
+            tileExchangeSeconds[index] += report.exchangeSeconds;
+            if (report.updateSeconds + report.exchangeSeconds > slowest->updateSeconds + slowest->exchangeSeconds) {
+                slowest = &report;
+            }
+        }
+
+        if (config.reportInterval > 0 && tick % config.reportInterval == 0) {
+            std::cout << "🧩 Tick " << tick << " -";
+            for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+                std::cout << " " << SpeciesName(static_cast<EntityType>(species)) << ": "
+                          << statistics.population[species] << ",";
+            }
+            std::cout << " Migrations: " << statistics.migrations
+                      << ", Tuile la plus lente: " << slowest->updateSeconds * 1000.0f << " ms + "
+                      << slowest->exchangeSeconds * 1000.0f << " ms d'échange" << std::endl;
+        }
+    }
+
+    // ⏱ Tuile la plus lente sur toute la simulation
+    for (int index = 0; index < tileCount; ++index) {
+        if (tileUpdateSeconds[index] + tileExchangeSeconds[index] >
+            statistics.slowestUpdateSeconds + statistics.slowestExchangeSeconds) {
+            statistics.slowestUpdateSeconds = tileUpdateSeconds[index];
+            statistics.slowestExchangeSeconds = tileExchangeSeconds[index];
+        }
+    }
+
+    // 🧹 Une tuile perdue bloque ses voisines : toutes sont arrêtées
+    if (failed) {
+        for (pid_t child : children) kill(child, SIGTERM);
+    }
+    for (pid_t child : children) {
+        int status = 0;
+        while (waitpid(child, &status, 0) < 0 && errno == EINTR) {
+        }
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+    }
+    CloseAll(links, reports);
+    return !failed && static_cast<int>(children.size()) == tileCount;
+}
+
+} // namespace Domain
+} // namespace Core
+} // namespace Ecosystem
@@ -1,29 +1,80 @@
 #include "Core/Ecosystem.hpp"
+#include "Core/Log.hpp"
+#include "Core/MotionKernel.hpp"
+#include "Core/Profiler.hpp"
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <sstream>
 
 namespace Ecosystem {
 namespace Core {
 
+// Nombre d'entités par bloc de travail parallèle
+static constexpr std::size_t kParallelGrain = 1024;
+
+// 🌾 Champ de nourriture : résolution, capacité et repousse maximale par cellule
+static constexpr float kFoodCellSize = 20.0f;
+static constexpr float kFoodCellCapacity = 4.0f;
+static constexpr float kMaxFoodRegrowth = 0.01f;  // Unités par seconde
+static constexpr float kBiteUnitsPerSecond = 1.0f;
+
+// 🌱 Probabilité par tick qu'une nouvelle plante pousse
+static constexpr double kPlantSpawnChance = 0.01;
+
+#if ECOSYSTEM_PROFILING
+static uint64_t ToProfilerTime(std::chrono::steady_clock::time_point time) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+#endif
+
 // 🏗 CONSTRUCTEUR
-Ecosystem::Ecosystem(float width, float height, int maxEntities)
+Ecosystem::Ecosystem(float width, float height, int maxEntities, uint32_t seed, bool verbose)
     : mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities),
-      mDayCycle(0), mRandomGenerator(std::random_device{}())
+      mDayCycle(0),
+      mVerbose(verbose),
+      mFood(width, height, kFoodCellSize, kFoodCellCapacity),
+      mPredatorIndex(width, height, Entity::kPerceptionRadius),
+      mBoundsMinimum(0.0f, 0.0f),
+      mBoundsMaximum(width, height),
+      mNextPlantSpawn(0),
+      mPlantSpawnDue(false),
+      mRandomGenerator(seed)
 {
+    // Fertilité aléatoire : chaque cellule repousse à son propre rythme
+    std::uniform_real_distribution<float> fertility(0.0f, kMaxFoodRegrowth);
+    for (std::size_t cell = 0; cell < mFood.GetCellCount(); ++cell) {
+        mFood.SetRegrowthRate(cell, fertility(mRandomGenerator));
+    }
+    SchedulePlantSpawn();
+
     // Initialisation des statistiques
-    mStats = {0, 0, 0, 0, 0, 0};
-    std::cout << "🌍 Écosystème créé: " << width << "x" << height << std::endl;
+    mStats = {};
+    mDistributionsValid = false;
+    mLastTick = {};
+    mEntities.Reserve(static_cast<std::size_t>(maxEntities));
+    mEntities.SetSeed(seed);
+    SetThreadCount(1);
+    if (mVerbose) {
+        std::cout << "🌍 Écosystème créé: " << width << "x" << height << std::endl;
+    }
 }
 
 // 🗑 DESTRUCTEUR
 Ecosystem::~Ecosystem() {
-    std::cout << "🌍 Écosystème détruit (" << mEntities.size() << " entités nettoyées)" << std::endl;
+    if (mVerbose) {
+        std::cout << "🌍 Écosystème détruit (" << mEntities.Size() << " entités nettoyées)" << std::endl;
+    }
 }
 
 // ⚙️ INITIALISATION
 void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int initialPlants) {
-    mEntities.clear();
-    mFoodSources.clear();
+    mEntities.Clear();
+    mFood.Clear();
+    mEvents.Reset(mEntities.GetLazyClock());
+    mEvents.Schedule({mNextPlantSpawn, EntityHandle{}, EventKind::PLANT_SPAWN});
     
     // Création des entités initiales
     for (int i = 0; i < initialHerbivores; ++i) {
@@ -38,128 +89,734 @@ void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int ini
     
     // Nourriture initiale
     SpawnFood(20);
+    UpdateStatistics();
     
-    std::cout << "🌱 Écosystème initialisé avec " << mEntities.size() << " entités" << std::endl;
+    if (mVerbose) {
+        std::cout << "🌱 Écosystème initialisé avec " << mEntities.Size() << " entités" << std::endl;
+    }
+}
+
+// 🏷 NOM D'UNE PHASE
+const char* PhaseName(Phase phase) {
+    switch (phase) {
+        case Phase::RANDOM: return "random";
+        case Phase::SPATIAL_INDEX: return "spatial_index";
+        case Phase::STEERING: return "steering";
+        case Phase::MOTION: return "motion";
+        case Phase::EATING: return "eating";
+        case Phase::REPRODUCTION: return "reproduction";
+        case Phase::REMOVAL: return "removal";
+        case Phase::GROWTH: return "growth";
+        case Phase::STATISTICS: return "statistics";
+        case Phase::COUNT: break;
+    }
+    return "?";
 }
 
 // 🔄 MISE À JOUR
 void Ecosystem::Update(float deltaTime) {
-    // Mise à jour de toutes les entités
-    for (auto& entity : mEntities) {
-        entity->Update(deltaTime);
+    ECOSYSTEM_PROFILE_ZONE("Ecosystem::Update");
+    using Clock = std::chrono::steady_clock;
+    mLastTick.births = 0;
+    mLastTick.deaths = 0;
+    const Clock::time_point tickStart = Clock::now();
+    Clock::time_point phaseStart = tickStart;
+    auto endPhase = [&](Phase phase) {
+        Clock::time_point now = Clock::now();
+        mLastTick.phaseSeconds[static_cast<std::size_t>(phase)] =
+            std::chrono::duration<float>(now - phaseStart).count();
+        // Les bornes déjà mesurées servent aussi de zone : aucune lecture d'horloge en plus
+        ECOSYSTEM_PROFILE_RECORD(PhaseName(phase), ToProfilerTime(phaseStart), ToProfilerTime(now));
+        phaseStart = now;
+    };
+
+    // Un nouveau pas de temps fige les espèces paresseuses et refait leur échéancier
+    if (mEntities.SetLazyStep(deltaTime)) {
+        RescheduleAll();
     }
+
+    // Tirages aléatoires du tick pour les entités non paresseuses, par lots
+    mEntities.SetTick(mDayCycle);
+    mThreadPool->ParallelFor(mEntities.Size(), kParallelGrain,
+        [this](std::size_t begin, std::size_t end, std::size_t) {
+            mEntities.ForEachSpeciesRange(begin, end, [this](auto species, std::size_t from, std::size_t to) {
+                if constexpr (!TraitsOf<decltype(species)>::kLazy) {
+                    mEntities.DrawTickUniforms(from, to);
+                }
+            });
+        });
+    endPhase(Phase::RANDOM);
+
+    // Perception via les index spatiaux
+    UpdateSpatialIndex();
+    endPhase(Phase::SPATIAL_INDEX);
+    HandleSteering(deltaTime);
+    endPhase(Phase::STEERING);
+
+    // Mise à jour de toutes les entités par blocs vectorisés
+    // (chacune ne modifie que ses propres données)
+    mThreadPool->ParallelFor(mEntities.Size(), kParallelGrain,
+        [this, deltaTime](std::size_t begin, std::size_t end, std::size_t) {
+            Motion::Advance(mEntities, begin, end, deltaTime);
+        });
+    mEntities.AdvanceLazyClock();
+    FireEvents();
+    endPhase(Phase::MOTION);
     
     // Gestion des comportements
-    HandleEating();
+    HandleEating(deltaTime);
+    endPhase(Phase::EATING);
     HandleReproduction();
+    endPhase(Phase::REPRODUCTION);
     RemoveDeadEntities();
-    HandlePlantGrowth(deltaTime);
+    endPhase(Phase::REMOVAL);
+    HandlePlantGrowth();
+    mFood.Regrow(deltaTime);
+    endPhase(Phase::GROWTH);
     
     // Mise à jour des statistiques
     UpdateStatistics();
+    endPhase(Phase::STATISTICS);
+    mLastTick.totalSeconds = std::chrono::duration<float>(phaseStart - tickStart).count();
     mDayCycle++;
+    if (mDayCycle % kTicksPerDay == 0) {
+        AdvanceDay();
+    }
 }
 
 // 🍎 GÉNÉRATION DE NOURRITURE
 void Ecosystem::SpawnFood(int count) {
+    // Une unité par position aléatoire, dans la limite de capacité des cellules
     for (int i = 0; i < count; ++i) {
-        if (mFoodSources.size() < 100) {  // Limite maximale de nourriture
-            Vector2D position = GetRandomPosition();
-            mFoodSources.emplace_back(position, 25.0f);
-        }
+        mFood.Deposit(GetRandomPosition(), 1.0f);
     }
 }
 
 // 💀 SUPPRESSION DES ENTITÉS MORTES
 void Ecosystem::RemoveDeadEntities() {
-    int initialCount = mEntities.size();
-    
-    mEntities.erase(
-        std::remove_if(mEntities.begin(), mEntities.end(),
-            [](const std::unique_ptr<Entity>& entity) { 
-                return !entity->IsAlive(); 
-            }),
-        mEntities.end()
-    );
-    
-    int removedCount = initialCount - mEntities.size();
+    std::array<std::size_t, kSpeciesCount> removed;
+    int removedCount = static_cast<int>(mEntities.RemoveDead(mLazyDead, &removed));
+    mLazyDead.clear();
     if (removedCount > 0) {
-        mStats.deathsToday += removedCount;
+        for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+            RecordDeaths(static_cast<EntityType>(species), static_cast<int>(removed[species]));
+        }
+        mLastTick.deaths += removedCount;
     }
 }
 
 // 👶 GESTION DE LA REPRODUCTION
 void Ecosystem::HandleReproduction() {
-    std::vector<std::unique_ptr<Entity>> newEntities;
-    
-    for (auto& entity : mEntities) {
-        if (entity->CanReproduce() && mEntities.size() < mMaxEntities) {
-            auto baby = entity->Reproduce();
-            if (baby) {
-                newEntities.push_back(std::move(baby));
-                mStats.birthsToday++;
+    // 1) Sélection des parents en parallèle, dans le tampon du travailleur ;
+    // les espèces paresseuses ne sont pas parcourues
+    for (auto& buffer : mBirthBuffers) {
+        buffer.clear();
+    }
+    mThreadPool->ParallelFor(mEntities.Size(), kParallelGrain,
+        [this](std::size_t begin, std::size_t end, std::size_t worker) {
+            std::vector<uint32_t>& buffer = mBirthBuffers[worker];
+            mEntities.ForEachSpeciesRange(begin, end, [&](auto species, std::size_t from, std::size_t to) {
+                if constexpr (!TraitsOf<decltype(species)>::kLazy) {
+                    for (std::size_t i = from; i < to; ++i) {
+                        if (Entity(mEntities, i).WantsToReproduce()) {
+                            buffer.push_back(static_cast<uint32_t>(i));
+                        }
+                    }
+                }
+            });
+        });
+
+    // 2) Fusion par indice de parent croissant : même résultat qu'en série.
+    // Les reproductions paresseuses dues ce tick sont vérifiées ; un point de
+    // contrôle de la recherche (Entity::NextReproductionTick) est replanifié.
+    mBirthOrder.clear();
+    for (const auto& buffer : mBirthBuffers) {
+        mBirthOrder.insert(mBirthOrder.end(), buffer.begin(), buffer.end());
+    }
+    for (EntityHandle handle : mLazyParents) {
+        std::size_t index = mEntities.Resolve(handle);
+        if (index == EntityStore::npos || !mEntities.alive[index]) continue;
+        if (Entity(mEntities, index).WantsToReproduce()) {
+            mBirthOrder.push_back(static_cast<uint32_t>(index));
+        } else {
+            ScheduleReproduction(index, mEntities.GetLazyClock() + 1);
+        }
+    }
+    mLazyParents.clear();
+    std::sort(mBirthOrder.begin(), mBirthOrder.end());
+
+    // 3) Naissances en fin de plage d'espèce, dans la limite de la population ;
+    // les parents sont suivis par poignée car une naissance décale les espèces suivantes
+    mBirthParents.clear();
+    for (uint32_t parent : mBirthOrder) {
+        mBirthParents.push_back(mEntities.GetHandle(parent));
+    }
+    const uint64_t nextClock = mEntities.GetLazyClock() + 1;
+    for (EntityHandle parent : mBirthParents) {
+        std::size_t index = mEntities.Resolve(parent);
+        bool lazy = IsLazySpecies(mEntities.type[index]);
+        if (mEntities.Size() >= static_cast<std::size_t>(mMaxEntities)) {
+            // Population pleine : les parents paresseux retentent au tick suivant
+            if (lazy) ScheduleReproduction(index, nextClock);
+            continue;
+        }
+        if (std::optional<Entity> child = Entity(mEntities, index).Reproduce()) {
+            RecordBirth(child->GetType());
+            std::size_t childIndex = child->GetIndex();
+            if (lazy) {
+                // Le coût de la reproduction change l'énergie : nouvelle échéance de mort
+                ScheduleEntity(mEntities.Resolve(parent));
             }
+            ScheduleEntity(childIndex);
+        } else if (lazy) {
+            ScheduleReproduction(index, nextClock);
         }
-    }    
-    
-    // Ajout des nouveaux entités
-    for (auto& newEntity : newEntities) {
-        mEntities.push_back(std::move(newEntity));
     }
 }
 
-// 🍽 GESTION DE L'ALIMENTATION
-void Ecosystem::HandleEating() {
-    // Ici on implémenterait la logique de recherche de nourriture
-    // Pour l'instant, gestion simplifiée
-    for (auto& entity : mEntities) {
-        if (entity->GetType() == EntityType::PLANT) {
-            // Les plantes génèrent de l'énergie
-            entity->Eat(0.1f);
+// ⏲ ÉCHÉANCIER
+// La mort par l'âge est programmée au pas qui la cause (la faim aussi pour une
+// espèce paresseuse) ; la prochaine reproduction paresseuse est cherchée à
+// partir de l'horloge suivante. Sans pas de temps connu, rien n'est programmé :
+// le premier Update refait tout l'échéancier.
+void Ecosystem::ScheduleEntity(std::size_t index) {
+    if (!mEntities.HasLazyStep()) return;
+    uint64_t death = mEntities.DeathTick(index);
+    if (death != EntityStore::kNever) {
+        mEvents.Schedule({death, mEntities.GetHandle(index), EventKind::DEATH});
+    }
+    if (IsLazySpecies(mEntities.type[index])) {
+        ScheduleReproduction(index, mEntities.GetLazyClock() + 1);
+    }
+}
+
+void Ecosystem::ScheduleReproduction(std::size_t index, uint64_t from) {
+    if (!mEntities.HasLazyStep()) return;
+    uint64_t tick = Entity(mEntities, index).NextReproductionTick(from, mEntities.DeathTick(index));
+    if (tick != EntityStore::kNever) {
+        mEvents.Schedule({tick, mEntities.GetHandle(index), EventKind::REPRODUCTION});
+    }
+}
+
+// 🌱 Une chance par tick : l'écart jusqu'à la prochaine pousse suit une loi géométrique
+void Ecosystem::SchedulePlantSpawn() {
+    std::geometric_distribution<uint64_t> gap(kPlantSpawnChance);
+    mNextPlantSpawn = mEntities.GetLazyClock() + 1 + gap(mRandomGenerator);
+    mEvents.Schedule({mNextPlantSpawn, EntityHandle{}, EventKind::PLANT_SPAWN});
+}
+
+void Ecosystem::RescheduleAll() {
+    mEvents.Reset(mEntities.GetLazyClock());
+    mEvents.Schedule({mNextPlantSpawn, EntityHandle{}, EventKind::PLANT_SPAWN});
+    for (std::size_t i = 0; i < mEntities.Size(); ++i) {
+        if (mEntities.alive[i]) ScheduleEntity(i);
+    }
+}
+
+// ⏰ Événements échus à l'horloge courante : les morts sont marquées ici (retrait
+// avec les autres), reproductions et pousses sont transmises aux phases suivantes
+void Ecosystem::FireEvents() {
+    const uint64_t clock = mEntities.GetLazyClock();
+    mDueEvents.clear();
+    mEvents.Advance(clock, mDueEvents);
+    for (const TimedEvent& event : mDueEvents) {
+        if (event.kind == EventKind::PLANT_SPAWN) {
+            mPlantSpawnDue = true;
+            continue;
+        }
+        std::size_t index = mEntities.Resolve(event.handle);
+        if (index == EntityStore::npos || !mEntities.alive[index]) continue;  // Mort entre-temps
+        if (event.kind == EventKind::REPRODUCTION) {
+            mLazyParents.push_back(event.handle);
+            continue;
+        }
+        if (!IsLazySpecies(mEntities.type[index])) {
+            if (mEntities.age[index] < mEntities.maxAge[index]) continue;  // Échéance périmée
+            mEntities.alive[index] = 0;
+            ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_DIED_OF_AGE, mEntities.id[index],
+                                mEntities.energy[index], 0.0f, mEntities.age[index]);
+            continue;  // Retirée par le parcours de sa plage
         }
+        if (mEntities.DeathTick(index) != event.tick) continue;  // Échéance périmée
+
+        // Même état qu'au pas fatal d'une mise à jour tick par tick : énergie après métabolisme
+        float energy = mEntities.GetEnergyAt(index, clock - 1) - mEntities.metabolism[index] * mEntities.GetLazyDeltaTime();
+        mEntities.Touch(index);
+        mEntities.energy[index] = energy;
+        mEntities.alive[index] = 0;
+        ECOSYSTEM_LOG_DEBUG(energy <= 0.0f ? Log::Event::ENTITY_STARVED : Log::Event::ENTITY_DIED_OF_AGE,
+                            mEntities.id[index], energy, 0.0f, mEntities.age[index]);
+        mLazyDead.push_back(event.handle);
     }
 }
 
+// 🍽 GESTION DE L'ALIMENTATION
+void Ecosystem::HandleEating(float deltaTime) {
+    // Les brouteurs mangent la cellule sous eux, dans la limite d'une bouchée
+    // et de leur faim. Passe séquentielle : plusieurs brouteurs partagent une cellule.
+    mEntities.ForEachSpeciesRange(0, mEntities.Size(), [&](auto species, std::size_t from, std::size_t to) {
+        if constexpr (TraitsOf<decltype(species)>::kGrazer) {
+            for (std::size_t i = from; i < to; ++i) {
+                if (!mEntities.alive[i]) continue;
+                float hunger = (mEntities.maxEnergy[i] - mEntities.energy[i]) / FoodField::kEnergyPerUnit;
+                float bite = std::min(kBiteUnitsPerSecond * deltaTime, hunger);
+                if (bite <= 0.0f) continue;
+                Vector2D position(mEntities.positionX[i], mEntities.positionY[i]);
+                float eaten = mFood.Consume(position, bite);
+                if (eaten > 0.0f) {
+                    Entity(mEntities, i).Eat(eaten * FoodField::kEnergyPerUnit);
+                }
+            }
+        }
+    });
+
+    // Photosynthèse : chaque entité ne modifie que sa propre énergie
+    // (incluse dans la forme close des espèces paresseuses)
+    mThreadPool->ParallelFor(mEntities.Size(), kParallelGrain,
+        [this](std::size_t begin, std::size_t end, std::size_t) {
+            mEntities.ForEachSpeciesRange(begin, end, [this](auto species, std::size_t from, std::size_t to) {
+                using Traits = TraitsOf<decltype(species)>;
+                if constexpr (Traits::kEnergyPerTick > 0.0f && !Traits::kLazy) {
+                    for (std::size_t i = from; i < to; ++i) {
+                        Entity(mEntities, i).Eat(Traits::kEnergyPerTick);
+                    }
+                }
+            });
+        });
+}
+
 // 📊 MISE À JOUR DES STATISTIQUES
 void Ecosystem::UpdateStatistics() {
-    mStats.totalHerbivores = 0;
-    mStats.totalCarnivores = 0;
-    mStats.totalPlants = 0;
-    mStats.totalFood = mFoodSources.size();    
-    
-    for (const auto& entity : mEntities) {
-        switch (entity->GetType()) {
-            case EntityType::HERBIVORE:
-                mStats.totalHerbivores++;
-                break;
-            case EntityType::CARNIVORE:
-                mStats.totalCarnivores++;
-                break;
-            case EntityType::PLANT:
-                mStats.totalPlants++;
-                break;
+    CountPopulations();
+    mStats.totalFood = static_cast<int>(mFood.GetTotalUnits());
+}
+
+// Les populations sont les tailles des plages d'espèces : aucun parcours
+void Ecosystem::CountPopulations() {
+    mStats.totalHerbivores = GetPopulation(EntityType::HERBIVORE);
+    mStats.totalCarnivores = GetPopulation(EntityType::CARNIVORE);
+    mStats.totalPlants = GetPopulation(EntityType::PLANT);
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        mStats.species[species].population = GetPopulation(static_cast<EntityType>(species));
+    }
+    mDistributionsValid = false;
+}
+
+// 👶 NAISSANCES ET MORTS - comptées là où elles se produisent
+void Ecosystem::RecordBirth(EntityType type) {
+    SpeciesStatistics& species = mStats.species[static_cast<std::size_t>(type)];
+    species.births++;
+    species.birthsToday++;
+    mStats.totalBirths++;
+    mStats.birthsToday++;
+    mLastTick.births++;
+}
+
+void Ecosystem::RecordDeaths(EntityType type, int count) {
+    SpeciesStatistics& species = mStats.species[static_cast<std::size_t>(type)];
+    species.deaths += count;
+    species.deathsToday += count;
+    mStats.totalDeaths += count;
+    mStats.deathsToday += count;
+}
+
+// 📅 CHANGEMENT DE JOUR - le jour écoulé devient la veille
+void Ecosystem::AdvanceDay() {
+    mStats.birthsYesterday = mStats.birthsToday;
+    mStats.deathsYesterday = mStats.deathsToday;
+    mStats.birthsToday = 0;
+    mStats.deathsToday = 0;
+    for (SpeciesStatistics& species : mStats.species) {
+        species.birthsYesterday = species.birthsToday;
+        species.deathsYesterday = species.deathsToday;
+        species.birthsToday = 0;
+        species.deathsToday = 0;
+    }
+    mStats.day = static_cast<int>(mDayCycle / kTicksPerDay);
+}
+
+// 📈 RÉPARTITIONS - un parcours de chaque plage d'espèce, seulement à la demande
+const Ecosystem::Distributions& Ecosystem::GetDistributions() const {
+    if (!mDistributionsValid) {
+        ComputeDistributions();
+        mDistributionsValid = true;
+    }
+    return mDistributions;
+}
+
+void Ecosystem::ComputeDistributions() const {
+    auto bucket = [](float ratio) {
+        float scaled = ratio * static_cast<float>(kHistogramBuckets);
+        if (!(scaled > 0.0f)) return std::size_t(0);
+        return std::min(static_cast<std::size_t>(scaled), kHistogramBuckets - 1);
+    };
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        Distribution& energy = mDistributions[species].energy;
+        Distribution& age = mDistributions[species].age;
+        energy = {};
+        age = {};
+        double energySum = 0.0;
+        double ageSum = 0.0;
+        std::size_t alive = 0;
+        EntityType type = static_cast<EntityType>(species);
+        for (std::size_t i = mEntities.SpeciesBegin(type); i < mEntities.SpeciesEnd(type); ++i) {
+            if (!mEntities.alive[i]) continue;
+            float entityEnergy = mEntities.GetEnergy(i);
+            int currentAge = mEntities.GetAge(i);
+            float entityAge = static_cast<float>(currentAge);
+            if (alive == 0) {
+                energy.minimum = energy.maximum = entityEnergy;
+                age.minimum = age.maximum = entityAge;
+            }
+            energy.minimum = std::min(energy.minimum, entityEnergy);
+            energy.maximum = std::max(energy.maximum, entityEnergy);
+            age.minimum = std::min(age.minimum, entityAge);
+            age.maximum = std::max(age.maximum, entityAge);
+            energySum += entityEnergy;
+            ageSum += entityAge;
+            energy.histogram[bucket(entityEnergy / mEntities.maxEnergy[i])]++;
+            int maxAge = mEntities.maxAge[i] > 0 ? mEntities.maxAge[i] : 1;
+            // Même découpage entier que les stades de vie de la télémétrie
+            age.histogram[std::min(static_cast<std::size_t>(currentAge > 0 ? currentAge : 0) *
+                                   kHistogramBuckets / static_cast<std::size_t>(maxAge), kHistogramBuckets - 1)]++;
+            ++alive;
+        }
+        if (alive > 0) {
+            energy.mean = static_cast<float>(energySum / alive);
+            age.mean = static_cast<float>(ageSum / alive);
         }
     }
 }
 
-// 🎲 CRÉATION D'ENTITÉ ALÉATOIRE
-void Ecosystem::SpawnRandomEntity(EntityType type) {
-    if (mEntities.size() >= mMaxEntities) return;
+// 🎲 CRÉATION D'ENTITÉ ALÉATOIRE - false si la population est pleine
+bool Ecosystem::SpawnRandomEntity(EntityType type) {
+    if (mEntities.Size() >= static_cast<std::size_t>(mMaxEntities)) return false;
     
     Vector2D position = GetRandomPosition();
-    std::string name;
-    switch (type) {
-        case EntityType::HERBIVORE:
-            name = "Herbivore_" + std::to_string(mStats.totalHerbivores);
-            break;
-        case EntityType::CARNIVORE:
-            name = "Carnivore_" + std::to_string(mStats.totalCarnivores);
-            break;
-        case EntityType::PLANT:
-            name = "Plant_" + std::to_string(mStats.totalPlants);
-            break;
-    }    
-    mEntities.push_back(std::make_unique<Entity>(type, position, name));
+    std::size_t index = mEntities.Add(type, position);
+    ScheduleEntity(index);
+    return true;
+}
+
+// 🎯 AJOUT D'ENTITÉ
+Entity Ecosystem::AddEntity(EntityType type, Vector2D position, const std::string& name) {
+    std::size_t index = mEntities.Add(type, position);
+    if (!name.empty()) {
+        mEntities.SetName(index, name);
+    }
+    ScheduleEntity(index);
+    CountPopulations();
+    return Entity(mEntities, index);
+}
+
+// 🧬 PARAMÈTRES D'UNE ESPÈCE
+void Ecosystem::SetSpecies(EntityType type, const SpeciesParameters& parameters) {
+    mEntities.SetSpecies(type, parameters);
+    if (IsLazySpecies(type)) {
+        RescheduleAll();  // La reproduction paresseuse dépend de la chance de l'espèce
+    }
+}
+
+// 🔗 RÉSOLUTION D'UNE POIGNÉE (vide si l'entité est morte entre-temps)
+std::optional<Entity> Ecosystem::FindEntity(EntityHandle handle) {
+    std::size_t index = mEntities.Resolve(handle);
+    if (index == EntityStore::npos) return std::nullopt;
+    return Entity(mEntities, index);
+}
+
+// 🔑 EMPREINTE DE L'ÉTAT - FNV-1a sur des mots de 64 bits (un passage par tableau)
+static void HashBytes(uint64_t& hash, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ull;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+}
+
+template <typename T>
+static void HashArray(uint64_t& hash, const std::vector<T>& values) {
+    HashBytes(hash, values.data(), values.size() * sizeof(T));
+}
+
+uint64_t Ecosystem::ComputeStateHash() const {
+    uint64_t hash = 1469598103934665603ull;
+    HashArray(hash, mEntities.id);
+    HashArray(hash, mEntities.type);
+    HashArray(hash, mEntities.positionX);
+    HashArray(hash, mEntities.positionY);
+    HashArray(hash, mEntities.velocityX);
+    HashArray(hash, mEntities.velocityY);
+    HashArray(hash, mEntities.speed);
+    HashArray(hash, mEntities.energy);
+    HashArray(hash, mEntities.maxEnergy);
+    HashArray(hash, mEntities.metabolism);
+    HashArray(hash, mEntities.age);
+    HashArray(hash, mEntities.maxAge);
+    HashArray(hash, mEntities.alive);
+    HashArray(hash, mEntities.size);
+    HashArray(hash, mEntities.touchTick);
+    for (std::size_t cell = 0; cell < mFood.GetCellCount(); ++cell) {
+        float units = mFood.GetUnits(cell);
+        HashBytes(hash, &units, sizeof(units));
+    }
+    uint64_t clocks[3] = {mDayCycle, mEntities.GetLazyClock(), mNextPlantSpawn};
+    HashBytes(hash, clocks, sizeof(clocks));
+    // Le générateur n'est pas parcouru : le prochain tirage d'une copie suffit à révéler un écart
+    std::mt19937 generator = mRandomGenerator;
+    uint32_t draw = generator();
+    HashBytes(hash, &draw, sizeof(draw));
+    return hash;
+}
+
+// 🍎 AJOUT DE NOURRITURE
+void Ecosystem::AddFood(Vector2D position, float energy) {
+    mFood.Deposit(position, energy / FoodField::kEnergyPerUnit);
+}
+
+// 🗺 RECONSTRUCTION DES INDEX SPATIAUX
+void Ecosystem::UpdateSpatialIndex() {
+    mPredatorIndex.Clear();
+    mEntities.ForEachSpeciesRange(0, mEntities.Size(), [this](auto species, std::size_t from, std::size_t to) {
+        if constexpr (TraitsOf<decltype(species)>::kPredator) {
+            for (std::size_t i = from; i < to; ++i) {
+                if (mEntities.alive[i]) {
+                    mPredatorIndex.Insert(static_cast<uint32_t>(i), mEntities.positionX[i], mEntities.positionY[i]);
+                }
+            }
+        }
+    });
+    // Prédateurs des tuiles voisines : visibles mais jamais modifiés ici
+    for (const Vector2D& ghost : mGhostPredators) {
+        mPredatorIndex.Insert(UINT32_MAX, ghost.x, ghost.y);
+    }
+    mPredatorIndex.Build();
+}
+
+// 🧭 ORIENTATION DES ANIMAUX
+// Les index sont figés pendant cette phase : chaque entité ne modifie que sa vitesse
+void Ecosystem::HandleSteering(float deltaTime) {
+    mThreadPool->ParallelFor(mEntities.Size(), kParallelGrain,
+        [this, deltaTime](std::size_t begin, std::size_t end, std::size_t) {
+            mEntities.ForEachSpeciesRange(begin, end, [&](auto species, std::size_t from, std::size_t to) {
+                using Traits = TraitsOf<decltype(species)>;
+                if constexpr (Traits::kMobile) {
+                    for (std::size_t i = from; i < to; ++i) {
+                        if (!mEntities.alive[i]) continue;
+
+                        Entity entity(mEntities, i);
+                        Vector2D force = entity.StayInBounds(mBoundsMinimum, mBoundsMaximum);
+                        if constexpr (Traits::kGrazer) {
+                            // La fuite prime sur la recherche de nourriture
+                            force = force + entity.SeekFood(mFood) + entity.AvoidPredators(mPredatorIndex) * 3.0f;
+                        }
+                        entity.ApplyForce(force * deltaTime);
+                    }
+                }
+            });
+        });
+}
+
+// 🧵 NOMBRE DE THREADS (1 = exécution série, 0 = tous les cœurs)
+void Ecosystem::SetThreadCount(std::size_t threadCount) {
+    mThreadPool = std::make_unique<ThreadPool>(threadCount);
+    mBirthBuffers.assign(mThreadPool->GetThreadCount(), {});
+}
+
+// 💾 EN-TÊTE DE L'ÉCOSYSTÈME DANS UN INSTANTANÉ
+struct EcosystemHeader {
+    float worldWidth;
+    float worldHeight;
+    int32_t maxEntities;
+    int32_t reserved;
+    uint64_t dayCycle;
+};
+static_assert(sizeof(EcosystemHeader) == 24, "en-tête d'instantané sans remplissage attendu");
+
+// 📊 COMPTEURS DANS UN INSTANTANÉ - champs de largeur fixe, écrits un à un.
+// Populations et nourriture se recomptent au chargement, les répartitions
+// se recalculent à la demande : elles ne sont pas enregistrées.
+struct SpeciesCounters {
+    int64_t births;
+    int64_t deaths;
+    int32_t birthsToday;
+    int32_t deathsToday;
+    int32_t birthsYesterday;
+    int32_t deathsYesterday;
+};
+static_assert(sizeof(SpeciesCounters) == 32, "compteurs d'instantané sans remplissage attendus");
+
+struct StatisticsCounters {
+    int64_t totalBirths;
+    int64_t totalDeaths;
+    int32_t birthsToday;
+    int32_t deathsToday;
+    int32_t birthsYesterday;
+    int32_t deathsYesterday;
+    int32_t day;
+    int32_t reserved;
+    SpeciesCounters species[kSpeciesCount];
+};
+static_assert(sizeof(StatisticsCounters) == 40 + 32 * kSpeciesCount, "compteurs d'instantané sans remplissage attendus");
+
+// 💾 SAUVEGARDE
+bool Ecosystem::SaveSnapshot(const std::string& path) const {
+    Snapshot::Writer writer;
+    EcosystemHeader header = {mWorldWidth, mWorldHeight, mMaxEntities, 0, mDayCycle};
+    writer.AddValue(Snapshot::Section::ECOSYSTEM, header);
+    StatisticsCounters counters = {};
+    counters.totalBirths = mStats.totalBirths;
+    counters.totalDeaths = mStats.totalDeaths;
+    counters.birthsToday = mStats.birthsToday;
+    counters.deathsToday = mStats.deathsToday;
+    counters.birthsYesterday = mStats.birthsYesterday;
+    counters.deathsYesterday = mStats.deathsYesterday;
+    counters.day = mStats.day;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        const SpeciesStatistics& source = mStats.species[species];
+        SpeciesCounters& target = counters.species[species];
+        target.births = source.births;
+        target.deaths = source.deaths;
+        target.birthsToday = source.birthsToday;
+        target.deathsToday = source.deathsToday;
+        target.birthsYesterday = source.birthsYesterday;
+        target.deathsYesterday = source.deathsYesterday;
+    }
+    writer.AddValue(Snapshot::Section::STATISTICS, counters);
+    writer.AddValue(Snapshot::Section::SCHEDULE, mNextPlantSpawn);
+
+    // L'état du std::mt19937 n'a pas de représentation binaire portable : forme texte standard
+    std::ostringstream generatorState;
+    generatorState << mRandomGenerator;
+    std::string state = generatorState.str();
+    writer.AddCopy(Snapshot::Section::RANDOM_GENERATOR, state.data(), sizeof(char), state.size());
+
+    mEntities.Save(writer);
+    mFood.Save(writer);
+    if (!writer.WriteFile(path)) {
+        return false;
+    }
+    std::cout << "💾 Instantané sauvegardé: " << path << " (" << mEntities.Size()
+              << " entités, cycle " << mDayCycle << ")" << std::endl;
+    return true;
+}
+
+// 📖 CHARGEMENT
+bool Ecosystem::LoadSnapshot(const std::string& path) {
+    Snapshot::Reader reader;
+    if (!reader.Open(path)) {
+        return false;
+    }
+
+    EcosystemHeader header = {};
+    StatisticsCounters counters = {};
+    std::vector<char> state;
+    std::mt19937 generator;
+    bool valid = reader.ReadValue(Snapshot::Section::ECOSYSTEM, header) &&
+                 reader.ReadValue(Snapshot::Section::STATISTICS, counters) &&
+                 reader.ReadArray(Snapshot::Section::RANDOM_GENERATOR, state) &&
+                 header.worldWidth > 0.0f && header.worldHeight > 0.0f;
+    if (valid) {
+        std::istringstream generatorState(std::string(state.begin(), state.end()));
+        valid = static_cast<bool>(generatorState >> generator);
+    }
+
+    // Les sous-systèmes ne sont remplacés qu'une fois entièrement lus
+    EntityStore entities;
+    FoodField food(1.0f, 1.0f, kFoodCellSize, kFoodCellCapacity);  // Géométrie lue dans l'instantané
+    if (!valid || !entities.Load(reader) || !food.Load(reader)) {
+        std::cerr << "❌ Instantané incomplet ou corrompu: " << path << std::endl;
+        return false;
+    }
+
+    mWorldWidth = header.worldWidth;
+    mWorldHeight = header.worldHeight;
+    mMaxEntities = header.maxEntities;
+    mDayCycle = header.dayCycle;
+    mStats = {};
+    mStats.totalBirths = counters.totalBirths;
+    mStats.totalDeaths = counters.totalDeaths;
+    mStats.birthsToday = counters.birthsToday;
+    mStats.deathsToday = counters.deathsToday;
+    mStats.birthsYesterday = counters.birthsYesterday;
+    mStats.deathsYesterday = counters.deathsYesterday;
+    mStats.day = counters.day;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        const SpeciesCounters& source = counters.species[species];
+        SpeciesStatistics& target = mStats.species[species];
+        target.births = source.births;
+        target.deaths = source.deaths;
+        target.birthsToday = source.birthsToday;
+        target.deathsToday = source.deathsToday;
+        target.birthsYesterday = source.birthsYesterday;
+        target.deathsYesterday = source.deathsYesterday;
+    }
+    mRandomGenerator = generator;
+    mEntities = std::move(entities);
+    mEntities.Reserve(std::max(mEntities.Size(), static_cast<std::size_t>(mMaxEntities)));
+    mFood = std::move(food);
+    mPredatorIndex.Resize(mWorldWidth, mWorldHeight, Entity::kPerceptionRadius);
+    mBoundsMinimum = Vector2D(0.0f, 0.0f);
+    mBoundsMaximum = Vector2D(mWorldWidth, mWorldHeight);
+    mGhostPredators.clear();
+    mLazyDead.clear();
+    mLazyParents.clear();
+    mPlantSpawnDue = false;
+    // L'échéancier se déduit des entités ; seule la prochaine pousse est enregistrée
+    if (!reader.ReadValue(Snapshot::Section::SCHEDULE, mNextPlantSpawn)) {
+        SchedulePlantSpawn();
+    }
+    RescheduleAll();
+    UpdateStatistics();  // Populations et nourriture recomptées
+
+    std::cout << "📖 Instantané chargé: " << path << " (" << mEntities.Size()
+              << " entités, cycle " << mDayCycle << ")" << std::endl;
+    return true;
+}
+
+// 🧩 BORDS DU MONDE ENTIER, exprimés dans le repère de la tuile
+void Ecosystem::SetWorldBounds(Vector2D minimum, Vector2D maximum) {
+    mBoundsMinimum = minimum;
+    mBoundsMaximum = maximum;
+}
+
+// 🧳 DÉPART DES ENTITÉS SORTIES DE LA TUILE
+// Ce ne sont pas des morts : seules les populations sont ajustées
+std::size_t Ecosystem::ExtractEmigrants(Vector2D minimum, Vector2D maximum,
+                                        std::vector<Migrant>& migrants, std::vector<char>& names) {
+    std::size_t extracted = 0;
+    std::size_t index = 0;
+    while (index < mEntities.Size()) {
+        float x = mEntities.positionX[index];
+        float y = mEntities.positionY[index];
+        if (x >= minimum.x && x < maximum.x && y >= minimum.y && y < maximum.y) {
+            ++index;
+            continue;
+        }
+        migrants.emplace_back();
+        mEntities.Export(index, migrants.back(), names);
+        // L'entité déplacée à cet indice sera examinée au tour suivant
+        mEntities.RemoveAt(index);
+        ++extracted;
+    }
+    CountPopulations();
+    return extracted;
+}
+
+// 🧳 ARRIVÉE D'ENTITÉS VENUES D'UNE TUILE VOISINE (positions déjà dans le repère local)
+// Elles sont toujours accueillies, même au-delà de la population maximale
+void Ecosystem::AddImmigrants(const std::vector<Migrant>& migrants, const std::vector<char>& names) {
+    std::size_t nameOffset = 0;
+    for (const Migrant& migrant : migrants) {
+        std::size_t index = mEntities.Import(migrant, names.data() + nameOffset);
+        nameOffset += migrant.nameLength;
+        ScheduleEntity(index);
+    }
+    CountPopulations();
 }
 
 // 🎯 POSITION ALÉATOIRE
@@ -170,32 +827,15 @@ Vector2D Ecosystem::GetRandomPosition() const {
 }
 
 // 🌿 CROISSANCE DES PLANTES
-void Ecosystem::HandlePlantGrowth(float deltaTime) {
-    // Occasionnellement, faire pousser de nouvelles plantes
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    if (chance(mRandomGenerator) < 0.01f && mEntities.size() < mMaxEntities) {
-        SpawnRandomEntity(EntityType::PLANT);
-    }
-}
-
-// 🎨 RENDU
-void Ecosystem::Render(SDL_Renderer* renderer) const {
-    // Rendu de la nourriture
-    for (const auto& food : mFoodSources) {
-        SDL_FRect rect = {
-            food.position.x - 3.0f,
-            food.position.y - 3.0f,
-            6.0f,
-            6.0f
-        };
-        SDL_SetRenderDrawColor(renderer, food.color.r, food.color.g, food.color.b, food.color.a);
-        SDL_RenderFillRect(renderer, ▭);
-    }    
-    
-    // Rendu des entités
-    for (const auto& entity : mEntities) {
-        entity->Render(renderer);
+void Ecosystem::HandlePlantGrowth() {
+    // Occasionnellement, faire pousser de nouvelles plantes (événement de l'échéancier)
+    if (!mPlantSpawnDue) return;
+    mPlantSpawnDue = false;
+    // Une pousse est une naissance ; la population initiale et les immigrants n'en sont pas
+    if (SpawnRandomEntity(EntityType::PLANT)) {
+        RecordBirth(EntityType::PLANT);
     }
+    SchedulePlantSpawn();
 }
 
 } // namespace Core
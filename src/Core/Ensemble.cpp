@@ -0,0 +1,348 @@
+#include "Core/Ensemble.hpp"
+#include "Core/Ecosystem.hpp"
+#include "Core/RingBuffer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace Ecosystem {
+namespace Core {
+namespace Ensemble {
+
+static constexpr std::size_t kMaxRuns = 10000000;
+
+// 🧬 Espèce désignée par sa clé (SpeciesKey), kSpeciesCount si inconnue
+static std::size_t FindSpecies(const std::string& key) {
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        if (key == SpeciesKey(static_cast<EntityType>(species))) return species;
+    }
+    return kSpeciesCount;
+}
+
+static std::string Trim(const std::string& text) {
+    std::size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    std::size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+static bool ParseNumber(const std::string& text, double& value) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return end == text.c_str() + text.size() && std::isfinite(value);
+}
+
+static bool IsKnownKey(const std::string& key) {
+    static const char* kGlobalKeys[] = {"world_width", "world_height", "max_entities", "herbivores",
+                                        "carnivores", "plants", "seed", "ticks", "dt"};
+    static const char* kSpeciesKeys[] = {"initial_energy", "max_energy", "metabolism",
+                                         "max_age", "size", "reproduction_chance"};
+    if (std::find(std::begin(kGlobalKeys), std::end(kGlobalKeys), key) != std::end(kGlobalKeys)) return true;
+    std::size_t dot = key.find('.');
+    if (dot == std::string::npos) return false;
+    return FindSpecies(key.substr(0, dot)) < kSpeciesCount &&
+           std::find(std::begin(kSpeciesKeys), std::end(kSpeciesKeys), key.substr(dot + 1)) != std::end(kSpeciesKeys);
+}
+
+// 🔧 APPLICATION D'UNE VALEUR À UNE CONFIGURATION
+static bool ApplyValue(RunConfig& config, const std::string& key, const std::string& text) {
+    double value = 0.0;
+    if (!ParseNumber(text, value)) return false;
+    auto integer = [value]() { return std::floor(value) == value; };
+
+    if (key == "world_width") { config.worldWidth = static_cast<float>(value); return value > 0.0; }
+    if (key == "world_height") { config.worldHeight = static_cast<float>(value); return value > 0.0; }
+    if (key == "max_entities") { config.maxEntities = static_cast<int>(value); return integer() && value >= 0.0; }
+    if (key == "herbivores") { config.herbivores = static_cast<int>(value); return integer() && value >= 0.0; }
+    if (key == "carnivores") { config.carnivores = static_cast<int>(value); return integer() && value >= 0.0; }
+    if (key == "plants") { config.plants = static_cast<int>(value); return integer() && value >= 0.0; }
+    if (key == "seed") { config.seed = static_cast<uint32_t>(value); return integer() && value >= 0.0 && value <= 4294967295.0; }
+    if (key == "ticks") { config.ticks = static_cast<long long>(value); return integer() && value >= 0.0; }
+    if (key == "dt") { config.deltaTime = static_cast<float>(value); return value > 0.0; }
+
+    // 🧬 <espèce>.<paramètre>
+    std::size_t dot = key.find('.');
+    if (dot == std::string::npos) return false;
+    std::size_t found = FindSpecies(key.substr(0, dot));
+    std::string parameter = key.substr(dot + 1);
+    if (found == kSpeciesCount) return false;
+    SpeciesParameters& species = config.species[found];
+    if (parameter == "initial_energy") { species.initialEnergy = static_cast<float>(value); return true; }
+    if (parameter == "max_energy") { species.maxEnergy = static_cast<float>(value); return value > 0.0; }
+    if (parameter == "metabolism") { species.metabolism = static_cast<float>(value); return true; }
+    if (parameter == "max_age") { species.maxAge = static_cast<int32_t>(value); return integer() && value > 0.0; }
+    if (parameter == "size") { species.size = static_cast<float>(value); return value > 0.0; }
+    if (parameter == "reproduction_chance") { species.reproductionChance = static_cast<float>(value); return value >= 0.0 && value <= 1.0; }
+    return false;
+}
+
+// 📏 LISTE DE VALEURS : « a, b, c » et intervalles « début..fin[:pas] »
+static bool ExpandValues(const std::string& text, std::vector<std::string>& values, std::string& error) {
+    std::stringstream items(text);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        item = Trim(item);
+        std::size_t range = item.find("..");
+        if (range == std::string::npos) {
+            if (item.empty()) {
+                error = "valeur vide";
+                return false;
+            }
+            values.push_back(item);
+            continue;
+        }
+
+        std::string endText = item.substr(range + 2);
+        std::string stepText = "1";
+        std::size_t colon = endText.find(':');
+        if (colon != std::string::npos) {
+            stepText = endText.substr(colon + 1);
+            endText = endText.substr(0, colon);
+        }
+        double start = 0.0, end = 0.0, step = 0.0;
+        if (!ParseNumber(Trim(item.substr(0, range)), start) || !ParseNumber(Trim(endText), end) ||
+            !ParseNumber(Trim(stepText), step) || step <= 0.0 || end < start) {
+            error = "intervalle invalide: " + item;
+            return false;
+        }
+        double count = std::floor((end - start) / step + 1e-9) + 1.0;
+        if (count > static_cast<double>(kMaxRuns)) {
+            error = "intervalle trop long: " + item;
+            return false;
+        }
+        bool integral = std::floor(start) == start && std::floor(step) == step;
+        for (long long i = 0; i < static_cast<long long>(count); ++i) {
+            double value = start + static_cast<double>(i) * step;
+            if (integral) {
+                values.push_back(std::to_string(static_cast<long long>(value)));
+            } else {
+                std::ostringstream formatted;
+                formatted << value;
+                values.push_back(formatted.str());
+            }
+        }
+    }
+    if (values.empty()) {
+        error = "aucune valeur";
+        return false;
+    }
+    return true;
+}
+
+// 📖 LECTURE DE LA SPÉCIFICATION
+bool Sweep::Parse(std::istream& input, std::string& error) {
+    mKeys.clear();
+    mValues.clear();
+    std::string line;
+    int lineNumber = 0;
+    double runCount = 1.0;
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        std::string content = Trim(line.substr(0, line.find('#')));
+        if (content.empty()) continue;
+
+        std::string where = "ligne " + std::to_string(lineNumber) + ": ";
+        std::size_t equals = content.find('=');
+        if (equals == std::string::npos) {
+            error = where + "« clé = valeurs » attendu";
+            return false;
+        }
+        std::string key = Trim(content.substr(0, equals));
+        if (!IsKnownKey(key)) {
+            error = where + "clé inconnue: " + key;
+            return false;
+        }
+        if (std::find(mKeys.begin(), mKeys.end(), key) != mKeys.end()) {
+            error = where + "clé répétée: " + key;
+            return false;
+        }
+        std::vector<std::string> values;
+        if (!ExpandValues(content.substr(equals + 1), values, error)) {
+            error = where + error;
+            return false;
+        }
+        // Chaque valeur est vérifiée dès la lecture, pas au milieu du balayage
+        RunConfig scratch;
+        for (const std::string& value : values) {
+            if (!ApplyValue(scratch, key, value)) {
+                error = where + "valeur « " + value + " » invalide pour " + key;
+                return false;
+            }
+        }
+        runCount *= static_cast<double>(values.size());
+        if (runCount > static_cast<double>(kMaxRuns)) {
+            error = where + "plus de " + std::to_string(kMaxRuns) + " exécutions";
+            return false;
+        }
+        mKeys.push_back(key);
+        mValues.push_back(std::move(values));
+    }
+    return true;
+}
+
+bool Sweep::Load(const std::string& path, std::string& error) {
+    std::ifstream input(path);
+    if (!input) {
+        error = "fichier introuvable: " + path;
+        return false;
+    }
+    return Parse(input, error);
+}
+
+// 🔢 PRODUIT CARTÉSIEN (la dernière clé varie le plus vite)
+std::size_t Sweep::GetRunCount() const {
+    std::size_t count = 1;
+    for (const auto& values : mValues) {
+        count *= values.size();
+    }
+    return count;
+}
+
+std::vector<std::string> Sweep::GetValues(std::size_t index) const {
+    std::vector<std::string> chosen(mKeys.size());
+    for (std::size_t key = mKeys.size(); key-- > 0;) {
+        chosen[key] = mValues[key][index % mValues[key].size()];
+        index /= mValues[key].size();
+    }
+    return chosen;
+}
+
+RunConfig Sweep::GetRun(std::size_t index) const {
+    RunConfig config = mBase;
+    config.index = index;
+    std::vector<std::string> chosen = GetValues(index);
+    for (std::size_t key = 0; key < mKeys.size(); ++key) {
+        ApplyValue(config, mKeys[key], chosen[key]);  // Déjà validée par Parse
+    }
+    return config;
+}
+
+// ▶️ UNE EXÉCUTION
+RunSummary Run(const RunConfig& config, bool stopOnExtinction) {
+    auto start = std::chrono::steady_clock::now();
+    Ecosystem ecosystem(config.worldWidth, config.worldHeight, config.maxEntities, config.seed, false);
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        ecosystem.SetSpecies(static_cast<EntityType>(species), config.species[species]);
+    }
+    ecosystem.Initialize(config.herbivores, config.carnivores, config.plants);
+
+    auto populations = [&ecosystem]() {
+        std::array<int, kSpeciesCount> counts = {};
+        for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+            counts[species] = ecosystem.GetPopulation(static_cast<EntityType>(species));
+        }
+        return counts;
+    };
+    const std::array<int, kSpeciesCount> initial = populations();
+
+    RunSummary summary = {};
+    summary.index = config.index;
+    summary.extinctSpecies = -1;
+    summary.peakPopulation = initial;
+    std::array<double, kSpeciesCount> populationSum = {};
+    std::array<int, kSpeciesCount> current = initial;
+
+    while (summary.ticks < config.ticks) {
+        ecosystem.Update(config.deltaTime);
+        ++summary.ticks;
+        summary.births += ecosystem.GetLastTick().births;
+        summary.deaths += ecosystem.GetLastTick().deaths;
+        current = populations();
+        for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+            populationSum[species] += current[species];
+            summary.peakPopulation[species] = std::max(summary.peakPopulation[species], current[species]);
+            if (summary.extinctSpecies < 0 && initial[species] > 0 && current[species] == 0) {
+                summary.extinctSpecies = static_cast<int>(species);
+                summary.extinctionTick = summary.ticks;
+            }
+        }
+        if (stopOnExtinction && summary.extinctSpecies >= 0) break;
+    }
+
+    summary.finalPopulation = current;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        summary.meanPopulation[species] = summary.ticks > 0 ? populationSum[species] / summary.ticks : initial[species];
+    }
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
+
+// 🚀 ENSEMBLE
+bool RunSweep(const Sweep& sweep, std::size_t threads, bool stopOnExtinction, std::ostream& output) {
+    const std::size_t runCount = sweep.GetRunCount();
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, runCount);
+
+    // 📄 En-tête : paramètres balayés, puis bilan
+    output << "run";
+    for (const std::string& key : sweep.GetKeys()) output << ',' << key;
+    output << ",ticks,extinct,extinction_tick";
+    for (const char* prefix : {"final_", "peak_", "mean_"}) {
+        for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+            output << ',' << prefix << SpeciesKey(static_cast<EntityType>(species));
+        }
+    }
+    output << ",births,deaths,seconds\n";
+
+    // 🧵 Chaque travailleur prend la prochaine exécution libre ; les bilans
+    // remontent par une file sans verrou vers le thread appelant, seul à écrire
+    MpscRingBuffer<RunSummary> results(1024);
+    std::atomic<std::size_t> nextRun(0);
+    std::vector<std::thread> workers;
+    for (std::size_t worker = 0; worker < threads; ++worker) {
+        workers.emplace_back([&]() {
+            std::size_t index;
+            while ((index = nextRun.fetch_add(1, std::memory_order_relaxed)) < runCount) {
+                RunSummary summary = Run(sweep.GetRun(index), stopOnExtinction);
+                while (!results.TryPush(summary)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::size_t written = 0;
+    std::size_t extinctions = 0;
+    RunSummary summary;
+    while (written < runCount) {
+        if (!results.TryPop(summary)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        output << summary.index;
+        for (const std::string& value : sweep.GetValues(summary.index)) output << ',' << value;
+        const char* extinct = summary.extinctSpecies >= 0
+                            ? SpeciesKey(static_cast<EntityType>(summary.extinctSpecies)) : "none";
+        output << ',' << summary.ticks << ',' << extinct << ','
+               << (summary.extinctSpecies >= 0 ? summary.extinctionTick : -1);
+        for (int population : summary.finalPopulation) output << ',' << population;
+        for (int population : summary.peakPopulation) output << ',' << population;
+        for (double population : summary.meanPopulation) output << ',' << population;
+        output << ',' << summary.births << ',' << summary.deaths << ',' << summary.seconds << '\n';
+        output.flush();
+
+        ++written;
+        if (summary.extinctSpecies >= 0) ++extinctions;
+        if (written * 10 / runCount != (written - 1) * 10 / runCount || written == runCount) {
+            std::cerr << "🎲 " << written << "/" << runCount << " exécutions (" << extinctions
+                      << " extinctions)" << std::endl;
+        }
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return static_cast<bool>(output);
+}
+
+} // namespace Ensemble
+} // namespace Core
+} // namespace Ecosystem
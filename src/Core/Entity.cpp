@@ -1,208 +1,170 @@
 #include "Core/Entity.hpp"
+#include "Core/Log.hpp"
+#include "Core/MotionKernel.hpp"
 #include <cmath>
-#include <iostream>
 #include <algorithm>
 
 namespace Ecosystem {
 namespace Core {
 
-// 🏗 CONSTRUCTEUR PRINCIPAL
-Entity::Entity(EntityType type, Vector2D pos, std::string entityName)
-    : mType(type), position(pos), name(entityName), 
-      mRandomGenerator(std::random_device{}())  // Initialisation du générateur aléatoire
-{
-    // 🔧 INITIALISATION SELON LE TYPE
-    switch(mType) {
-        case EntityType::HERBIVORE:
-            mEnergy = 80.0f;
-            mMaxEnergy = 150.0f;
-            mMaxAge = 200;
-            color = Color::Blue();
-            size = 8.0f;
-            break;
-            
-        case EntityType::CARNIVORE:
-            mEnergy = 100.0f;
-            mMaxEnergy = 200.0f;
-            mMaxAge = 150;
-            color = Color::Red();
-            size = 12.0f;
-            break;
-            
-        case EntityType::PLANT:
-            mEnergy = 50.0f;
-            mMaxEnergy = 100.0f;
-            mMaxAge = 300;
-            color = Color::Green();
-            size = 6.0f;
-            break;
-    }    
-    mAge = 0;
-    mIsAlive = true;
-    mVelocity = GenerateRandomDirection();
-    
-    std::cout << "🌱 Entité créée: " << name << " à (" << position.x << ", " << position.y << ")" << std::endl;
+// ⚙️ MISE À JOUR PRINCIPALE
+// Métabolisme, vieillissement, mouvement et vitalité : chemin scalaire du
+// noyau de mouvement, utilisé par blocs entiers dans Ecosystem::Update.
+// Hors de l'échéancier de l'écosystème : l'âge maximal est vérifié ici
+void Entity::Update(float deltaTime) {
+    Motion::Advance(Motion::Path::SCALAR, *mStore, mIndex, mIndex + 1, deltaTime);
+    if (IsAlive() && mStore->age[mIndex] >= mStore->maxAge[mIndex]) {
+        mStore->alive[mIndex] = 0;
+        ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_DIED_OF_AGE, mStore->id[mIndex], GetEnergy(), 0.0f, GetAge());
+    }
 }
 
-// 🏗 CONSTRUCTEUR DE COPIE
-Entity::Entity(const Entity& other)
-    : mType(other.mType), position(other.position), name(other.name + "_copy"),
-      mEnergy(other.mEnergy * 0.7f),  // Enfant a moins d'énergie
-      mMaxEnergy(other.mMaxEnergy),
-      mAge(0),  // Nouvelle entité, âge remis à 0
-      mMaxAge(other.mMaxAge),
-      mIsAlive(true),
-      mVelocity(other.mVelocity),
-      color(other.color),
-      size(other.size * 0.8f),  // Enfant plus petit
-      mRandomGenerator(std::random_device{}())
-{
-    std::cout << "👶 Copie d'entité créée: " << name << std::endl;
+// 🍽 MANGER
+void Entity::Eat(float energy) {
+    mStore->Touch(mIndex);
+    float& current = mStore->energy[mIndex];
+    current += energy;
+    if (current > mStore->maxEnergy[mIndex]) {
+        current = mStore->maxEnergy[mIndex];
+    }
+    ECOSYSTEM_LOG_TRACE(Log::Event::ENTITY_ATE, mStore->id[mIndex], energy);
 }
 
-// 🗑 DESTRUCTEUR
-Entity::~Entity() {
-    std::cout << "💀 Entité détruite: " << name << " (Âge: " << mAge << ")" << std::endl;
+// 👶 REPRODUCTION
+bool Entity::CanReproduce() const {
+    return IsAlive() && GetEnergy() > mStore->maxEnergy[mIndex] * kReproductionEnergyRatio &&
+           GetAge() > kReproductionMinAge;
 }
 
-// ⚙️ MISE À JOUR PRINCIPALE
-void Entity::Update(float deltaTime) {
-    if (!mIsAlive) return;
-    // 🔄 PROCESSUS DE VIE
-    ConsumeEnergy(deltaTime);
-    Age(deltaTime);
-    Move(deltaTime);
-    CheckVitality();
+// 🎲 Chance de reproduction de ce tick (sans effet de bord)
+bool Entity::WantsToReproduce() const {
+    return CanReproduce() && mStore->GetUniforms(mIndex)[3] < mStore->GetSpecies(mStore->type[mIndex]).reproductionChance;
 }
 
-// 🚶 MOUVEMENT
-void Entity::Move(float deltaTime) {
-    if (mType == EntityType::PLANT) return;  // Les plantes ne bougent pas    
-    
-    // 🎲 Comportement aléatoire occasionnel
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    if (chance(mRandomGenerator) < 0.02f) {
-        mVelocity = GenerateRandomDirection();
-    }    
-    
-    // 📐 Application du mouvement
-    position = position + mVelocity * deltaTime * 20.0f;
-    
-    // 🔄 Consommation d'énergie due au mouvement
-    mEnergy -= mVelocity.Distance(Vector2D(0, 0)) * deltaTime * 0.1f;
-}
+// 🌿 Les conditions sont évaluées en forme close à chaque horloge candidate,
+// et le tirage est celui que WantsToReproduce fera à cette horloge
+uint64_t Entity::NextReproductionTick(uint64_t from, uint64_t deathTick) const {
+    static constexpr uint64_t kMaxScan = 4096;  // Au-delà : point de contrôle
+    const EntityStore& store = *mStore;
+    float chance = store.GetSpecies(GetType()).reproductionChance;
+    if (chance <= 0.0f || !store.HasLazyStep()) return EntityStore::kNever;
+
+    // Premières horloges où l'âge, puis l'énergie, suffisent (l'âge ne fait que croître)
+    uint64_t touch = store.touchTick[mIndex];
+    uint64_t start = std::max(from, touch);
+    int age = store.age[mIndex];
+    int ageStep = store.GetAgeAt(mIndex, touch + 1) - age;
+    if (age <= kReproductionMinAge) {
+        if (ageStep <= 0) return EntityStore::kNever;
+        start = std::max(start, touch + static_cast<uint64_t>((kReproductionMinAge - age) / ageStep + 1));
+    }
+    float threshold = store.maxEnergy[mIndex] * kReproductionEnergyRatio;
+    auto fed = [&](uint64_t clock) { return store.GetEnergyAt(mIndex, clock) > threshold; };
+    bool growing = store.GetEnergyAt(mIndex, touch + 1) > store.energy[mIndex];
+    if (!fed(start)) {
+        if (!growing) return EntityStore::kNever;
+        float change = store.GetEnergyAt(mIndex, touch + 1) - store.energy[mIndex];
+        uint64_t clock = touch + static_cast<uint64_t>(std::max(0.0, (static_cast<double>(threshold) - store.energy[mIndex]) / change));
+        clock = std::max(clock, start);
+        while (clock > start && fed(clock - 1)) --clock;
+        while (!fed(clock)) ++clock;
+        start = clock;
+    }
 
-// 🍽 MANGER
-void Entity::Eat(float energy) {
-    mEnergy += energy;
-    if (mEnergy > mMaxEnergy) {
-        mEnergy = mMaxEnergy;
+    uint64_t end = std::min(deathTick, start + kMaxScan);
+    for (uint64_t clock = start; clock < end; ++clock) {
+        if (!fed(clock)) return EntityStore::kNever;  // Énergie décroissante : plus jamais
+        if (Random::Uniforms(store.GetSeed(), GetId(), clock, Random::Stream::TICK)[3] < chance) {
+            return clock;
+        }
     }
-    std::cout << "🍽 " << name << " mange et gagne " << energy << " énergie" << std::endl;
+    return end < deathTick ? end : EntityStore::kNever;
 }
 
-// 🔄 CONSOMMATION D'ÉNERGIE
-void Entity::ConsumeEnergy(float deltaTime) {
-    float baseConsumption = 0.0f;
-    
-    switch(mType) {
-        case EntityType::HERBIVORE:
-            baseConsumption = 1.5f;
-            break;
-        case EntityType::CARNIVORE:
-            baseConsumption = 2.0f;
-            break;
-        case EntityType::PLANT:
-            baseConsumption = -0.5f;  // Les plantes génèrent de l'énergie !
-            break;
-    }    
-    
-    mEnergy -= baseConsumption * deltaTime;
-}
+std::optional<Entity> Entity::Reproduce() {
+    if (!WantsToReproduce()) return std::nullopt;
 
-// 🎂 VIEILLISSEMENT
-void Entity::Age(float deltaTime) {
-    mAge += static_cast<int>(deltaTime * 10.0f);  // Accéléré pour la simulation
+    mStore->Touch(mIndex);
+    mStore->energy[mIndex] *= 0.6f;  // Coût énergétique de la reproduction
+    return Entity(*mStore, mStore->AddChild(mIndex));  // Copie du parent
 }
 
-// ❤️ VÉRIFICATION DE LA SANTÉ
-void Entity::CheckVitality() {
-    if (mEnergy <= 0.0f || mAge >= mMaxAge) {
-        mIsAlive = false;
-        std::cout << "💀 " << name << " meurt - ";
-        if (mEnergy <= 0) std::cout << "Faim";
-        else std::cout << "Vieillesse";
-        std::cout << std::endl;
+// 🧲 APPLICATION D'UNE FORCE
+void Entity::ApplyForce(Vector2D force) {
+    float& velocityX = mStore->velocityX[mIndex];
+    float& velocityY = mStore->velocityY[mIndex];
+    velocityX += force.x;
+    velocityY += force.y;
+
+    // Vitesse bornée à celle d'une direction aléatoire maximale
+    float speed = std::sqrt(velocityX * velocityX + velocityY * velocityY);
+    if (speed > 1.0f) {
+        velocityX /= speed;
+        velocityY /= speed;
+        speed = std::sqrt(velocityX * velocityX + velocityY * velocityY);
     }
+    mStore->speed[mIndex] = speed;
 }
 
-// 👶 REPRODUCTION
-bool Entity::CanReproduce() const {
-    return mIsAlive && mEnergy > mMaxEnergy * 0.8f && mAge > 20;
+// 🍎 RECHERCHE DE NOURRITURE - direction vers la source la plus proche
+Vector2D Entity::SeekFood(const FoodField& food) const {
+    Vector2D position = GetPosition();
+    Vector2D target;
+    if (!food.FindNearest(position, kPerceptionRadius, 0.5f, target)) {
+        return Vector2D(0, 0);
+    }
+    float dx = target.x - position.x;
+    float dy = target.y - position.y;
+    float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance < 1e-3f) return Vector2D(0, 0);
+    return Vector2D(dx / distance, dy / distance);
 }
 
-std::unique_ptr<Entity> Entity::Reproduce() {
-    if (!CanReproduce()) return nullptr;
-    
-    // 🎲 Chance de reproduction
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    if (chance(mRandomGenerator) < 0.3f) {
-        mEnergy *= 0.6f;  // Coût énergétique de la reproduction
-        return std::make_unique<Entity>(*this);  // Utilise le constructeur de copie
+// 🏃 FUITE - somme des répulsions des prédateurs proches
+Vector2D Entity::AvoidPredators(const SpatialGrid& predatorIndex) const {
+    Vector2D position = GetPosition();
+    SpatialGrid::Neighbor neighbors[kMaxSensedPredators];
+    std::size_t count = predatorIndex.QueryNearest(position, kMaxSensedPredators, kPerceptionRadius, neighbors);
+
+    Vector2D flee(0, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const SpatialGrid::Neighbor& predator = neighbors[i];
+        float distance = std::sqrt(predator.distanceSquared);
+        if (distance < 1e-3f) continue;
+        // Plus le prédateur est proche, plus la répulsion est forte
+        float weight = (kPerceptionRadius - distance) / (kPerceptionRadius * distance);
+        flee = flee + Vector2D(position.x - predator.x, position.y - predator.y) * weight;
     }
-    return nullptr;
+    return flee;
 }
 
-// 🎲 GÉNÉRATION DE DIRECTION ALÉATOIRE
-Vector2D Entity::GenerateRandomDirection() {
-    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-    return Vector2D(dist(mRandomGenerator), dist(mRandomGenerator));
+// 🧱 RESTER DANS LE MONDE
+Vector2D Entity::StayInBounds(Vector2D minimum, Vector2D maximum) const {
+    const float margin = 20.0f;
+    Vector2D position = GetPosition();
+    Vector2D force(0, 0);
+    if (position.x < minimum.x + margin) force.x = 1.0f;
+    else if (position.x > maximum.x - margin) force.x = -1.0f;
+    if (position.y < minimum.y + margin) force.y = 1.0f;
+    else if (position.y > maximum.y - margin) force.y = -1.0f;
+    return force;
 }
 
 // 🎨 CALCUL DE LA COULEUR BASÉE SUR L'ÉTAT
 Color Entity::CalculateColorBasedOnState() const {
-    float energyRatio = GetEnergyPercentage();
-    
-    Color baseColor = color;
-    
+    return CalculateColor(GetColor(), GetEnergyPercentage());
+}
+
+Color Entity::CalculateColor(Color baseColor, float energyRatio) {
     // 🔴 Rouge si faible énergie
     if (energyRatio < 0.3f) {
         baseColor.r = 255;
         baseColor.g = static_cast<uint8_t>(baseColor.g * energyRatio);
         baseColor.b = static_cast<uint8_t>(baseColor.b * energyRatio);
-    }    
-    
-    return baseColor;
-}
-
-// 🎨 RENDU GRAPHIQUE
-void Entity::Render(SDL_Renderer* renderer) const {
-    if (!mIsAlive) return;
-    
-    Color renderColor = CalculateColorBasedOnState();
-    SDL_FRect rect = {
-        position.x - size / 2.0f,
-        position.y - size / 2.0f,
-        size,
-        size
-    };
-    
-    SDL_SetRenderDrawColor(renderer, renderColor.r, renderColor.g, renderColor.b, renderColor.a);
-    SDL_RenderFillRect(renderer, ▭);
-    
-    // 🔵 Indicateur d'énergie (barre de vie)
-    if (mType != EntityType::PLANT) {
-        float energyBarWidth = size * GetEnergyPercentage();
-        SDL_FRect energyBar = {
-            position.x - size / 2.0f,
-            position.y - size / 2.0f - 3.0f,
-            energyBarWidth,
-            2.0f
-        };
-        SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-        SDL_RenderFillRect(renderer, &energyBar);
     }
+
+    return baseColor;
 }
 
 } // namespace Core
-} // namespace Ecosystem
\ No newline at end of file
+} // namespace Ecosystem
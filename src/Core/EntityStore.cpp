@@ -0,0 +1,664 @@
+#include "Core/EntityStore.hpp"
+#include "Core/Log.hpp"
+#include "Core/MotionKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧹 VIDAGE
+void EntityStore::Clear() {
+    Resize(0);
+    mSpeciesBegin.fill(0);
+    mAssignedNames.clear();
+    mNameTable.Clear();
+    // Toutes les poignées existantes deviennent invalides
+    mFreeSlots.clear();
+    for (std::size_t s = mSlotGeneration.size(); s > 0; --s) {
+        mSlotGeneration[s - 1]++;
+        mFreeSlots.push_back(static_cast<uint32_t>(s - 1));
+    }
+}
+
+// 📦 RÉSERVATION
+void EntityStore::Reserve(std::size_t capacity) {
+    positionX.reserve(capacity);
+    positionY.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    speed.reserve(capacity);
+    energy.reserve(capacity);
+    metabolism.reserve(capacity);
+    maxEnergy.reserve(capacity);
+    age.reserve(capacity);
+    maxAge.reserve(capacity);
+    type.reserve(capacity);
+    alive.reserve(capacity);
+    uniforms.reserve(capacity);
+    size.reserve(capacity);
+    color.reserve(capacity);
+    id.reserve(capacity);
+    slot.reserve(capacity);
+    touchTick.reserve(capacity);
+    mSlotToIndex.reserve(capacity);
+    mSlotGeneration.reserve(capacity);
+    mFreeSlots.reserve(capacity);
+}
+
+// 🎲 TIRAGES DU TICK - un bloc Philox par entité de [begin, end)
+void EntityStore::DrawTickUniforms(std::size_t begin, std::size_t end) {
+    Random::FillUniforms(mSeed, id.data() + begin, end - begin, mTick, Random::Stream::TICK,
+                         uniforms.data() + begin);
+}
+
+// 🧬 TRAITS À L'EXÉCUTION - tables construites une fois depuis les traits
+const std::array<SpeciesParameters, kSpeciesCount>& DefaultSpeciesTable() {
+    static const std::array<SpeciesParameters, kSpeciesCount> defaults = [] {
+        std::array<SpeciesParameters, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            table[static_cast<std::size_t>(decltype(species)::value)] = TraitsOf<decltype(species)>::kDefaults;
+        });
+        return table;
+    }();
+    return defaults;
+}
+
+SpeciesParameters DefaultSpecies(EntityType type) {
+    return DefaultSpeciesTable()[static_cast<std::size_t>(type)];
+}
+
+const char* SpeciesName(EntityType type) {
+    static const std::array<const char*, kSpeciesCount> names = [] {
+        std::array<const char*, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            table[static_cast<std::size_t>(decltype(species)::value)] = TraitsOf<decltype(species)>::kName;
+        });
+        return table;
+    }();
+    return names[static_cast<std::size_t>(type)];
+}
+
+const char* SpeciesKey(EntityType type) {
+    static const std::array<const char*, kSpeciesCount> keys = [] {
+        std::array<const char*, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            table[static_cast<std::size_t>(decltype(species)::value)] = TraitsOf<decltype(species)>::kKey;
+        });
+        return table;
+    }();
+    return keys[static_cast<std::size_t>(type)];
+}
+
+bool IsLazySpecies(EntityType type) {
+    static const std::array<bool, kSpeciesCount> lazy = [] {
+        std::array<bool, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            using Traits = TraitsOf<decltype(species)>;
+            static_assert(!Traits::kLazy || (!Traits::kMobile && !Traits::kGrazer && !Traits::kPredator),
+                          "une espèce paresseuse doit être immobile et sans interaction");
+            table[static_cast<std::size_t>(decltype(species)::value)] = Traits::kLazy;
+        });
+        return table;
+    }();
+    return lazy[static_cast<std::size_t>(type)];
+}
+
+bool IsPredatorSpecies(EntityType type) {
+    static const std::array<bool, kSpeciesCount> predator = [] {
+        std::array<bool, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            table[static_cast<std::size_t>(decltype(species)::value)] = TraitsOf<decltype(species)>::kPredator;
+        });
+        return table;
+    }();
+    return predator[static_cast<std::size_t>(type)];
+}
+
+float SpeciesEnergyPerTick(EntityType type) {
+    static const std::array<float, kSpeciesCount> energy = [] {
+        std::array<float, kSpeciesCount> table = {};
+        ForEachSpecies([&](auto species) {
+            table[static_cast<std::size_t>(decltype(species)::value)] = TraitsOf<decltype(species)>::kEnergyPerTick;
+        });
+        return table;
+    }();
+    return energy[static_cast<std::size_t>(type)];
+}
+
+// 🪪 NOM LISIBLE D'UN IDENTIFIANT
+std::string FormatEntityId(uint64_t entityId) {
+    std::string text = SpeciesName(EntityIdSpecies(entityId));
+    text += "_" + std::to_string(EntityIdSerial(entityId));
+    if (uint32_t generation = EntityIdGeneration(entityId)) {
+        text += " (g" + std::to_string(generation) + ")";
+    }
+    return text;
+}
+
+// 🏗 CRÉATION D'UNE ENTITÉ
+std::size_t EntityStore::Add(EntityType entityType, Vector2D pos) {
+    std::size_t index = Emplace(MakeEntityId(entityType, 0, mNextId++));
+
+    // 🔧 INITIALISATION SELON L'ESPÈCE
+    const SpeciesParameters& species = GetSpecies(entityType);
+    energy[index] = species.initialEnergy;
+    maxEnergy[index] = species.maxEnergy;
+    metabolism[index] = species.metabolism;
+    maxAge[index] = species.maxAge;
+    color[index] = species.color;
+    size[index] = species.size;
+    type[index] = entityType;
+    positionX[index] = pos.x;
+    positionY[index] = pos.y;
+    age[index] = 0;
+    alive[index] = 1;
+
+    std::array<float, 4> spawn = Random::Uniforms(mSeed, id[index], mTick, Random::Stream::SPAWN);
+    velocityX[index] = spawn[0] * 2.0f - 1.0f;
+    velocityY[index] = spawn[1] * 2.0f - 1.0f;
+    speed[index] = std::sqrt(velocityX[index] * velocityX[index] + velocityY[index] * velocityY[index]);
+
+    ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_CREATED, id[index], pos.x, pos.y);
+    return index;
+}
+
+// 👶 CRÉATION D'UN ENFANT (copie du parent)
+std::size_t EntityStore::AddChild(std::size_t parent) {
+    std::size_t index = Emplace(MakeEntityId(type[parent], EntityIdGeneration(id[parent]) + 1, mNextId++));
+
+    type[index] = type[parent];
+    positionX[index] = positionX[parent];
+    positionY[index] = positionY[parent];
+    velocityX[index] = velocityX[parent];
+    velocityY[index] = velocityY[parent];
+    speed[index] = speed[parent];
+    energy[index] = energy[parent] * 0.7f;  // Enfant a moins d'énergie
+    maxEnergy[index] = maxEnergy[parent];
+    metabolism[index] = metabolism[parent];
+    age[index] = 0;  // Nouvelle entité, âge remis à 0
+    maxAge[index] = maxAge[parent];
+    alive[index] = 1;
+    color[index] = color[parent];
+    size[index] = size[parent] * 0.8f;  // Enfant plus petit
+
+    ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_BORN, id[index], energy[index]);
+    return index;
+}
+
+// 🏷 NOMS ATTRIBUÉS
+void EntityStore::SetName(std::size_t index, const std::string& entityName) {
+    if (entityName.empty()) {
+        mAssignedNames.erase(id[index]);
+        return;
+    }
+    mAssignedNames[id[index]] = mNameTable.Intern(entityName);
+}
+
+const std::string* EntityStore::FindAssignedName(std::size_t index) const {
+    if (mAssignedNames.empty()) return nullptr;
+    auto found = mAssignedNames.find(id[index]);
+    return found != mAssignedNames.end() ? &mNameTable.Get(found->second) : nullptr;
+}
+
+std::string EntityStore::GetName(std::size_t index) const {
+    const std::string* assigned = FindAssignedName(index);
+    return assigned ? *assigned : FormatEntityId(id[index]);
+}
+
+// 🧳 EXPORT D'UNE ENTITÉ VERS UN AUTRE STOCKAGE
+// Les migrants sont transmis tels quels entre processus de la même machine
+static_assert(std::is_trivially_copyable<Migrant>::value && sizeof(Migrant) == 64,
+              "disposition de Migrant inattendue");
+
+void EntityStore::Export(std::size_t index, Migrant& migrant, std::vector<char>& names) const {
+    migrant = {};
+    migrant.positionX = positionX[index];
+    migrant.positionY = positionY[index];
+    migrant.velocityX = velocityX[index];
+    migrant.velocityY = velocityY[index];
+    migrant.speed = speed[index];
+    migrant.energy = GetEnergy(index);
+    migrant.metabolism = metabolism[index];
+    migrant.maxEnergy = maxEnergy[index];
+    migrant.size = size[index];
+    migrant.age = GetAge(index);
+    migrant.maxAge = maxAge[index];
+    migrant.id = id[index];
+    migrant.color = color[index];
+    migrant.type = type[index];
+    if (const std::string* assigned = FindAssignedName(index)) {
+        migrant.nameLength = static_cast<uint32_t>(assigned->size());
+        names.insert(names.end(), assigned->begin(), assigned->end());
+    }
+}
+
+// 🧳 IMPORT - l'entité garde son identifiant, donc ses flux aléatoires
+std::size_t EntityStore::Import(const Migrant& migrant, const char* entityName) {
+    std::size_t index = Emplace(migrant.id);
+    positionX[index] = migrant.positionX;
+    positionY[index] = migrant.positionY;
+    velocityX[index] = migrant.velocityX;
+    velocityY[index] = migrant.velocityY;
+    speed[index] = migrant.speed;
+    energy[index] = migrant.energy;
+    metabolism[index] = migrant.metabolism;
+    maxEnergy[index] = migrant.maxEnergy;
+    size[index] = migrant.size;
+    age[index] = migrant.age;
+    maxAge[index] = migrant.maxAge;
+    color[index] = migrant.color;
+    type[index] = migrant.type;
+    alive[index] = 1;
+    if (migrant.nameLength > 0) {
+        SetName(index, std::string(entityName, migrant.nameLength));
+    }
+    return index;
+}
+
+// 🔐 NOUVEL EMPLACEMENT - à la fin de la plage de l'espèce de l'identifiant,
+// avec les tirages du tick courant. Chaque espèce suivante glisse d'une case :
+// sa première entité passe à sa fin.
+std::size_t EntityStore::Emplace(uint64_t entityId) {
+    const std::size_t species = static_cast<std::size_t>(EntityIdSpecies(entityId));
+    Resize(Size() + 1);
+    for (std::size_t next = kSpeciesCount; next-- > species + 1;) {
+        if (mSpeciesBegin[next] != mSpeciesBegin[next + 1]) {
+            MoveSlot(mSpeciesBegin[next], mSpeciesBegin[next + 1]);
+        }
+        mSpeciesBegin[next + 1]++;
+    }
+    std::size_t index = mSpeciesBegin[species + 1]++;
+
+    // Recyclage d'un emplacement libre si possible
+    uint32_t freeSlot;
+    if (!mFreeSlots.empty()) {
+        freeSlot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    } else {
+        freeSlot = static_cast<uint32_t>(mSlotToIndex.size());
+        mSlotToIndex.push_back(0);
+        mSlotGeneration.push_back(0);
+    }
+    mSlotToIndex[freeSlot] = static_cast<uint32_t>(index);
+    slot[index] = freeSlot;
+
+    id[index] = entityId;
+    uniforms[index] = Random::Uniforms(mSeed, id[index], mTick, Random::Stream::TICK);
+    touchTick[index] = mLazyClock;
+    return index;
+}
+
+// 💀 SUPPRESSION D'UNE ENTITÉ EN O(1)
+void EntityStore::RemoveAt(std::size_t index) {
+    ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_DESTROYED, id[index], 0.0f, 0.0f, age[index]);
+    if (!mAssignedNames.empty()) {
+        mAssignedNames.erase(id[index]);
+    }
+
+    // L'emplacement libéré change de génération : les poignées existantes expirent
+    uint32_t freedSlot = slot[index];
+    mSlotGeneration[freedSlot]++;
+    mFreeSlots.push_back(freedSlot);
+
+    // La dernière entité de l'espèce comble le trou, puis chaque espèce
+    // suivante recule d'une case : sa dernière entité passe à son début
+    const std::size_t species = static_cast<std::size_t>(type[index]);
+    std::size_t hole = index;
+    for (std::size_t next = species; next < kSpeciesCount; ++next) {
+        std::size_t last = mSpeciesBegin[next + 1] - 1;
+        if (last != hole) {
+            MoveSlot(last, hole);
+        }
+        hole = last;
+        mSpeciesBegin[next + 1]--;
+    }
+    Resize(Size() - 1);
+}
+
+// 💀 SUPPRESSION DES ENTITÉS MORTES
+std::size_t EntityStore::RemoveDead(const std::vector<EntityHandle>& lazyDead,
+                                    std::array<std::size_t, kSpeciesCount>* removedBySpecies) {
+    if (removedBySpecies) {
+        removedBySpecies->fill(0);
+    }
+    std::size_t removed = 0;
+    auto remove = [&](std::size_t index) {
+        if (removedBySpecies) {
+            (*removedBySpecies)[static_cast<std::size_t>(type[index])]++;
+        }
+        RemoveAt(index);
+        ++removed;
+    };
+
+    // Morts annoncées, par indice décroissant : un retrait ne déplace que des
+    // entités d'indice supérieur, l'ordre ne dépend que des indices
+    mLazyRemovals.clear();
+    for (EntityHandle handle : lazyDead) {
+        std::size_t index = Resolve(handle);
+        if (index != npos && !alive[index]) {
+            mLazyRemovals.push_back(index);
+        }
+    }
+    std::sort(mLazyRemovals.begin(), mLazyRemovals.end(), std::greater<std::size_t>());
+    mLazyRemovals.erase(std::unique(mLazyRemovals.begin(), mLazyRemovals.end()), mLazyRemovals.end());
+    for (std::size_t index : mLazyRemovals) {
+        remove(index);
+    }
+
+    // Autres espèces : parcours de leurs plages
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        if (IsLazySpecies(static_cast<EntityType>(species))) continue;
+        std::size_t index = mSpeciesBegin[species];
+        while (index < mSpeciesBegin[species + 1]) {
+            if (alive[index]) {
+                ++index;
+                continue;
+            }
+            // L'entité déplacée à cet indice sera examinée au tour suivant
+            remove(index);
+        }
+    }
+    return removed;
+}
+
+// 🌿 ESPÈCES PARESSEUSES
+// Un pas retire metabolism × dt puis ajoute kEnergyPerTick, plafonné à
+// maxEnergy : la variation par pas est constante, d'où la forme close
+// min(maxEnergy, énergie + pas × variation).
+float EntityStore::GetEnergyAt(std::size_t index, uint64_t clock) const {
+    uint64_t steps = clock - touchTick[index];
+    if (steps == 0) return energy[index];
+    float change = SpeciesEnergyPerTick(type[index]) - metabolism[index] * mLazyDeltaTime;
+    return std::min(maxEnergy[index], energy[index] + static_cast<float>(steps) * change);
+}
+
+int EntityStore::GetAgeAt(std::size_t index, uint64_t clock) const {
+    int64_t current = age[index] + static_cast<int64_t>(clock - touchTick[index]) * mLazyAgeStep;
+    return static_cast<int>(std::min<int64_t>(current, INT32_MAX));
+}
+
+float EntityStore::GetEnergy(std::size_t index) const {
+    return IsLazySpecies(type[index]) ? GetEnergyAt(index, mLazyClock) : energy[index];
+}
+
+int EntityStore::GetAge(std::size_t index) const {
+    return IsLazySpecies(type[index]) ? GetAgeAt(index, mLazyClock) : age[index];
+}
+
+std::array<float, 4> EntityStore::GetUniforms(std::size_t index) const {
+    if (!IsLazySpecies(type[index])) return uniforms[index];
+    return Random::Uniforms(mSeed, id[index], mLazyClock, Random::Stream::TICK);
+}
+
+void EntityStore::Touch(std::size_t index) {
+    if (!IsLazySpecies(type[index]) || touchTick[index] == mLazyClock) return;
+    energy[index] = GetEnergy(index);
+    age[index] = GetAge(index);
+    touchTick[index] = mLazyClock;
+}
+
+bool EntityStore::SetLazyStep(float deltaTime) {
+    if (deltaTime == mLazyDeltaTime) return false;
+    if (HasLazyStep()) {
+        for (std::size_t i = 0; i < Size(); ++i) {
+            Touch(i);
+        }
+    }
+    mLazyDeltaTime = deltaTime;
+    mLazyAgeStep = Motion::AgeStep(deltaTime);
+    return true;
+}
+
+// 💀 Même règle que le noyau de mouvement : après le pas, énergie épuisée
+// (métabolisme retiré, avant la photosynthèse) ou âge maximal atteint.
+// L'âge des espèces non paresseuses est exact à l'horloge courante.
+uint64_t EntityStore::DeathTick(std::size_t index) const {
+    if (!HasLazyStep()) return kNever;
+    bool lazy = IsLazySpecies(type[index]);
+    uint64_t base = lazy ? touchTick[index] : mLazyClock;
+
+    uint64_t steps = kNever;
+    if (age[index] >= maxAge[index]) {
+        steps = 1;
+    } else if (mLazyAgeStep > 0) {
+        steps = static_cast<uint64_t>((maxAge[index] - age[index] + mLazyAgeStep - 1) / mLazyAgeStep);
+    }
+
+    float consumed = metabolism[index] * mLazyDeltaTime;
+    if (lazy && consumed > 0.0f) {
+        // Mort au pas j + 1 si l'énergie après j pas ne couvre pas le métabolisme
+        uint64_t touch = touchTick[index];
+        auto starving = [&](uint64_t applied) { return GetEnergyAt(index, touch + applied) - consumed <= 0.0f; };
+        float change = SpeciesEnergyPerTick(type[index]) - consumed;
+        if (starving(0)) {
+            steps = 1;
+        } else if (change < 0.0f) {
+            double estimate = (static_cast<double>(energy[index]) - consumed) / -change;
+            if (estimate + 1.0 < static_cast<double>(steps)) {
+                uint64_t applied = static_cast<uint64_t>(estimate);
+                while (applied > 0 && starving(applied - 1)) --applied;
+                while (!starving(applied)) ++applied;
+                steps = std::min(steps, applied + 1);
+            }
+        }
+    }
+    return steps == kNever ? kNever : base + steps;
+}
+
+// 🔗 RÉSOLUTION D'UNE POIGNÉE
+std::size_t EntityStore::Resolve(EntityHandle handle) const {
+    if (handle.slot >= mSlotGeneration.size() || mSlotGeneration[handle.slot] != handle.generation) {
+        return npos;
+    }
+    return mSlotToIndex[handle.slot];
+}
+
+// 💾 EN-TÊTE DU STOCKAGE DANS UN INSTANTANÉ
+struct StoreHeader {
+    uint64_t seed;
+    uint64_t tick;
+    uint64_t nextId;
+};
+
+struct LazyHeader {
+    uint64_t clock;
+    float deltaTime;
+    int32_t ageStep;
+};
+
+// 💾 SAUVEGARDE - un tableau par section, écrits tels quels
+void EntityStore::Save(Snapshot::Writer& writer) const {
+    using Snapshot::Section;
+    writer.AddValue(Section::STORE, StoreHeader{mSeed, mTick, mNextId});
+    writer.Add(Section::SPECIES, mSpecies.data(), sizeof(SpeciesParameters), mSpecies.size());
+    writer.AddArray(Section::POSITION_X, positionX);
+    writer.AddArray(Section::POSITION_Y, positionY);
+    writer.AddArray(Section::VELOCITY_X, velocityX);
+    writer.AddArray(Section::VELOCITY_Y, velocityY);
+    writer.AddArray(Section::SPEED, speed);
+    writer.AddArray(Section::ENERGY, energy);
+    writer.AddArray(Section::METABOLISM, metabolism);
+    writer.AddArray(Section::MAX_ENERGY, maxEnergy);
+    writer.AddArray(Section::AGE, age);
+    writer.AddArray(Section::MAX_AGE, maxAge);
+    writer.AddArray(Section::TYPE, type);
+    writer.AddArray(Section::ALIVE, alive);
+    writer.AddArray(Section::UNIFORMS, uniforms);
+    writer.AddArray(Section::SIZE, size);
+    writer.AddArray(Section::COLOR, color);
+    writer.AddArray(Section::ID, id);
+    writer.AddArray(Section::SLOT, slot);
+    writer.AddArray(Section::SLOT_TO_INDEX, mSlotToIndex);
+    writer.AddArray(Section::SLOT_GENERATION, mSlotGeneration);
+    writer.AddArray(Section::FREE_SLOTS, mFreeSlots);
+    writer.AddArray(Section::TOUCH_TICK, touchTick);
+    writer.AddValue(Section::LAZY, LazyHeader{mLazyClock, mLazyDeltaTime, mLazyAgeStep});
+
+    // Noms attribués : identifiants, caractères concaténés et indices de début
+    // (un de plus que de noms)
+    std::vector<uint64_t> namedIds;
+    std::vector<uint64_t> nameOffsets;
+    std::vector<char> nameCharacters;
+    namedIds.reserve(mAssignedNames.size());
+    nameOffsets.reserve(mAssignedNames.size() + 1);
+    nameOffsets.push_back(0);
+    for (const auto& assigned : mAssignedNames) {
+        const std::string& entityName = mNameTable.Get(assigned.second);
+        namedIds.push_back(assigned.first);
+        nameCharacters.insert(nameCharacters.end(), entityName.begin(), entityName.end());
+        nameOffsets.push_back(nameCharacters.size());
+    }
+    writer.AddCopy(Section::NAMED_IDS, namedIds.data(), sizeof(uint64_t), namedIds.size());
+    writer.AddCopy(Section::NAME_OFFSETS, nameOffsets.data(), sizeof(uint64_t), nameOffsets.size());
+    writer.AddCopy(Section::NAME_CHARACTERS, nameCharacters.data(), sizeof(char), nameCharacters.size());
+}
+
+// 📖 CHARGEMENT - dans un stockage temporaire, échangé seulement s'il est cohérent
+bool EntityStore::Load(const Snapshot::Reader& reader) {
+    using Snapshot::Section;
+    EntityStore loaded;
+    StoreHeader header;
+    LazyHeader lazy;
+    std::vector<uint64_t> namedIds;
+    std::vector<uint64_t> nameOffsets;
+    std::vector<char> nameCharacters;
+    bool complete = reader.ReadValue(Section::STORE, header) &&
+                    reader.ReadArray(Section::POSITION_X, loaded.positionX) &&
+                    reader.ReadArray(Section::POSITION_Y, loaded.positionY) &&
+                    reader.ReadArray(Section::VELOCITY_X, loaded.velocityX) &&
+                    reader.ReadArray(Section::VELOCITY_Y, loaded.velocityY) &&
+                    reader.ReadArray(Section::SPEED, loaded.speed) &&
+                    reader.ReadArray(Section::ENERGY, loaded.energy) &&
+                    reader.ReadArray(Section::METABOLISM, loaded.metabolism) &&
+                    reader.ReadArray(Section::MAX_ENERGY, loaded.maxEnergy) &&
+                    reader.ReadArray(Section::AGE, loaded.age) &&
+                    reader.ReadArray(Section::MAX_AGE, loaded.maxAge) &&
+                    reader.ReadArray(Section::TYPE, loaded.type) &&
+                    reader.ReadArray(Section::ALIVE, loaded.alive) &&
+                    reader.ReadArray(Section::UNIFORMS, loaded.uniforms) &&
+                    reader.ReadArray(Section::SIZE, loaded.size) &&
+                    reader.ReadArray(Section::COLOR, loaded.color) &&
+                    reader.ReadArray(Section::ID, loaded.id) &&
+                    reader.ReadArray(Section::SLOT, loaded.slot) &&
+                    reader.ReadArray(Section::SLOT_TO_INDEX, loaded.mSlotToIndex) &&
+                    reader.ReadArray(Section::SLOT_GENERATION, loaded.mSlotGeneration) &&
+                    reader.ReadArray(Section::FREE_SLOTS, loaded.mFreeSlots) &&
+                    reader.ReadArray(Section::TOUCH_TICK, loaded.touchTick) &&
+                    reader.ReadValue(Section::LAZY, lazy) &&
+                    reader.ReadArray(Section::NAMED_IDS, namedIds) &&
+                    reader.ReadArray(Section::NAME_OFFSETS, nameOffsets) &&
+                    reader.ReadArray(Section::NAME_CHARACTERS, nameCharacters);
+    if (!complete) return false;
+
+    // 🔍 Cohérence : tous les tableaux denses ont la même longueur
+    std::size_t count = loaded.type.size();
+    std::size_t lengths[] = {
+        loaded.positionX.size(), loaded.positionY.size(), loaded.velocityX.size(), loaded.velocityY.size(),
+        loaded.speed.size(), loaded.energy.size(), loaded.metabolism.size(), loaded.maxEnergy.size(),
+        loaded.age.size(), loaded.maxAge.size(), loaded.alive.size(), loaded.uniforms.size(),
+        loaded.size.size(), loaded.color.size(), loaded.id.size(), loaded.slot.size(), loaded.touchTick.size()
+    };
+    for (std::size_t length : lengths) {
+        if (length != count) return false;
+    }
+    if (nameOffsets.size() != namedIds.size() + 1 || nameOffsets.back() != nameCharacters.size() ||
+        loaded.mSlotGeneration.size() != loaded.mSlotToIndex.size()) {
+        return false;
+    }
+    // Chaque emplacement est soit occupé par exactement une entité, soit libre une seule fois
+    if (count + loaded.mFreeSlots.size() != loaded.mSlotToIndex.size()) return false;
+    std::vector<uint8_t> slotUsed(loaded.mSlotToIndex.size(), 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (loaded.slot[i] >= loaded.mSlotToIndex.size() || loaded.mSlotToIndex[loaded.slot[i]] != i) {
+            return false;
+        }
+        slotUsed[loaded.slot[i]] = 1;
+    }
+    for (uint32_t freeSlot : loaded.mFreeSlots) {
+        if (freeSlot >= slotUsed.size() || slotUsed[freeSlot]) return false;
+        slotUsed[freeSlot] = 1;
+    }
+
+    // Entités rangées par espèce : les plages se déduisent des types
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t species = static_cast<std::size_t>(loaded.type[i]);
+        if (species >= kSpeciesCount || (i > 0 && loaded.type[i] < loaded.type[i - 1])) return false;
+        loaded.mSpeciesBegin[species + 1]++;
+    }
+    for (std::size_t species = 1; species <= kSpeciesCount; ++species) {
+        loaded.mSpeciesBegin[species] += loaded.mSpeciesBegin[species - 1];
+    }
+
+    for (std::size_t i = 0; i < namedIds.size(); ++i) {
+        if (nameOffsets[i] > nameOffsets[i + 1]) return false;
+        std::string entityName(nameCharacters.data() + nameOffsets[i], nameCharacters.data() + nameOffsets[i + 1]);
+        loaded.mAssignedNames[namedIds[i]] = loaded.mNameTable.Intern(entityName);
+    }
+
+    // Espèces facultatives : un instantané qui n'en a pas garde les valeurs par défaut
+    std::vector<SpeciesParameters> species;
+    if (reader.ReadArray(Section::SPECIES, species) && species.size() == kSpeciesCount) {
+        std::copy(species.begin(), species.end(), loaded.mSpecies.begin());
+    }
+
+    loaded.mSeed = header.seed;
+    loaded.mTick = header.tick;
+    loaded.mNextId = header.nextId;
+    loaded.mLazyClock = lazy.clock;
+    loaded.mLazyDeltaTime = lazy.deltaTime;
+    loaded.mLazyAgeStep = lazy.ageStep;
+    *this = std::move(loaded);
+    return true;
+}
+
+// 🔐 DÉPLACEMENT D'UN EMPLACEMENT
+void EntityStore::MoveSlot(std::size_t from, std::size_t to) {
+    positionX[to] = positionX[from];
+    positionY[to] = positionY[from];
+    velocityX[to] = velocityX[from];
+    velocityY[to] = velocityY[from];
+    speed[to] = speed[from];
+    energy[to] = energy[from];
+    maxEnergy[to] = maxEnergy[from];
+    metabolism[to] = metabolism[from];
+    age[to] = age[from];
+    maxAge[to] = maxAge[from];
+    type[to] = type[from];
+    alive[to] = alive[from];
+    uniforms[to] = uniforms[from];
+    size[to] = size[from];
+    color[to] = color[from];
+    id[to] = id[from];
+    slot[to] = slot[from];
+    touchTick[to] = touchTick[from];
+    mSlotToIndex[slot[to]] = static_cast<uint32_t>(to);
+}
+
+// 🔐 REDIMENSIONNEMENT DE TOUS LES TABLEAUX
+void EntityStore::Resize(std::size_t count) {
+    positionX.resize(count);
+    positionY.resize(count);
+    velocityX.resize(count);
+    velocityY.resize(count);
+    speed.resize(count);
+    energy.resize(count);
+    maxEnergy.resize(count);
+    metabolism.resize(count);
+    age.resize(count);
+    maxAge.resize(count);
+    type.resize(count);
+    alive.resize(count);
+    uniforms.resize(count);
+    size.resize(count);
+    color.resize(count);
+    id.resize(count);
+    slot.resize(count);
+    touchTick.resize(count);
+}
+
+} // namespace Core
+} // namespace Ecosystem
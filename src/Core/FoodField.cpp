@@ -0,0 +1,170 @@
+#include "Core/FoodField.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+FoodField::FoodField(float width, float height, float cellSize, float cellCapacity)
+    : mCellSize(std::max(cellSize, 1.0f)), mInverseCellSize(1.0f / mCellSize),
+      mColumns(std::max(1, static_cast<int>(std::ceil(width * mInverseCellSize)))),
+      mRows(std::max(1, static_cast<int>(std::ceil(height * mInverseCellSize)))),
+      mCellCapacity(cellCapacity),
+      mUnits(static_cast<std::size_t>(mColumns) * mRows, 0.0f),
+      mRegrowthRate(mUnits.size(), 0.0f),
+      mTotalUnits(0.0)
+{
+}
+
+// 🧹 VIDAGE (les taux de repousse sont conservés)
+void FoodField::Clear() {
+    std::fill(mUnits.begin(), mUnits.end(), 0.0f);
+    mTotalUnits = 0.0;
+}
+
+// 🌱 REPOUSSE - sans branchement, par paquets de 8 cellules pour que le
+// compilateur vectorise aussi la somme (8 sommes partielles indépendantes)
+void FoodField::Regrow(float deltaTime) {
+    float* __restrict units = mUnits.data();
+    const float* __restrict rates = mRegrowthRate.data();
+    const float capacity = mCellCapacity;
+    const std::size_t count = mUnits.size();
+
+    float lanes[8] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        for (std::size_t lane = 0; lane < 8; ++lane) {
+            float grown = std::min(units[i + lane] + rates[i + lane] * deltaTime, capacity);
+            units[i + lane] = grown;
+            lanes[lane] += grown;
+        }
+    }
+    double total = 0.0;
+    for (; i < count; ++i) {
+        units[i] = std::min(units[i] + rates[i] * deltaTime, capacity);
+        total += units[i];
+    }
+    for (float lane : lanes) {
+        total += lane;
+    }
+    mTotalUnits = total;
+}
+
+// ➕ DÉPÔT
+float FoodField::Deposit(Vector2D position, float units) {
+    float& cell = mUnits[GetCellIndex(position)];
+    float added = std::min(units, mCellCapacity - cell);
+    if (added <= 0.0f) return 0.0f;
+    cell += added;
+    mTotalUnits += added;
+    return added;
+}
+
+// ➖ CONSOMMATION
+float FoodField::Consume(Vector2D position, float units) {
+    float& cell = mUnits[GetCellIndex(position)];
+    float taken = std::min(units, cell);
+    if (taken <= 0.0f) return 0.0f;
+    cell -= taken;
+    mTotalUnits -= taken;
+    return taken;
+}
+
+// 🔍 RECHERCHE PAR ANNEAUX DE CELLULES - coût borné par le rayon
+bool FoodField::FindNearest(Vector2D position, float maxRadius, float minUnits, Vector2D& found) const {
+    int centerColumn = std::clamp(static_cast<int>(std::floor(position.x * mInverseCellSize)), 0, mColumns - 1);
+    int centerRow = std::clamp(static_cast<int>(std::floor(position.y * mInverseCellSize)), 0, mRows - 1);
+    int maxRing = std::min(static_cast<int>(std::ceil(maxRadius * mInverseCellSize)), std::max(mColumns, mRows));
+
+    float bestDistanceSquared = maxRadius * maxRadius;
+    bool hasBest = false;
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        for (int row = centerRow - ring; row <= centerRow + ring; ++row) {
+            if (row < 0 || row >= mRows) continue;
+            bool edgeRow = (row == centerRow - ring || row == centerRow + ring);
+            int step = edgeRow ? 1 : std::max(1, 2 * ring);
+            for (int column = centerColumn - ring; column <= centerColumn + ring; column += step) {
+                if (column < 0 || column >= mColumns) continue;
+                std::size_t cell = static_cast<std::size_t>(row) * mColumns + column;
+                if (mUnits[cell] < minUnits) continue;
+
+                Vector2D center = GetCellCenter(cell);
+                float dx = center.x - position.x;
+                float dy = center.y - position.y;
+                float distanceSquared = dx * dx + dy * dy;
+                if (distanceSquared <= bestDistanceSquared) {
+                    bestDistanceSquared = distanceSquared;
+                    found = center;
+                    hasBest = true;
+                }
+            }
+        }
+        // Les anneaux suivants sont au moins à ring * cellSize
+        float ringDistance = ring * mCellSize;
+        if (hasBest && bestDistanceSquared <= ringDistance * ringDistance) break;
+    }
+    return hasBest;
+}
+
+// 💾 GÉOMÉTRIE DU CHAMP DANS UN INSTANTANÉ
+struct FoodHeader {
+    float cellSize;
+    float cellCapacity;
+    int32_t columns;
+    int32_t rows;
+};
+
+// 💾 SAUVEGARDE
+void FoodField::Save(Snapshot::Writer& writer) const {
+    writer.AddValue(Snapshot::Section::FOOD, FoodHeader{mCellSize, mCellCapacity, mColumns, mRows});
+    writer.AddArray(Snapshot::Section::FOOD_UNITS, mUnits);
+    writer.AddArray(Snapshot::Section::FOOD_REGROWTH, mRegrowthRate);
+}
+
+// 📖 CHARGEMENT
+bool FoodField::Load(const Snapshot::Reader& reader) {
+    FoodHeader header;
+    std::vector<float> units;
+    std::vector<float> regrowthRate;
+    if (!reader.ReadValue(Snapshot::Section::FOOD, header) ||
+        !reader.ReadArray(Snapshot::Section::FOOD_UNITS, units) ||
+        !reader.ReadArray(Snapshot::Section::FOOD_REGROWTH, regrowthRate)) {
+        return false;
+    }
+    if (header.cellSize < 1.0f || header.columns <= 0 || header.rows <= 0 ||
+        units.size() != static_cast<std::size_t>(header.columns) * header.rows ||
+        regrowthRate.size() != units.size()) {
+        return false;
+    }
+
+    mCellSize = header.cellSize;
+    mInverseCellSize = 1.0f / mCellSize;
+    mColumns = header.columns;
+    mRows = header.rows;
+    mCellCapacity = header.cellCapacity;
+    mUnits = std::move(units);
+    mRegrowthRate = std::move(regrowthRate);
+    mTotalUnits = 0.0;
+    for (float cellUnits : mUnits) {
+        mTotalUnits += cellUnits;
+    }
+    return true;
+}
+
+// 📐 CENTRE D'UNE CELLULE
+Vector2D FoodField::GetCellCenter(std::size_t cell) const {
+    int column = static_cast<int>(cell % mColumns);
+    int row = static_cast<int>(cell / mColumns);
+    return Vector2D((column + 0.5f) * mCellSize, (row + 0.5f) * mCellSize);
+}
+
+// 📐 CELLULE CONTENANT UNE POSITION (bornée à la grille)
+std::size_t FoodField::GetCellIndex(Vector2D position) const {
+    int column = std::clamp(static_cast<int>(std::floor(position.x * mInverseCellSize)), 0, mColumns - 1);
+    int row = std::clamp(static_cast<int>(std::floor(position.y * mInverseCellSize)), 0, mRows - 1);
+    return static_cast<std::size_t>(row) * mColumns + column;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,131 @@
+#include "Core/Log.hpp"
+#include "Core/EntityStore.hpp"
+#include <chrono>
+
+namespace Ecosystem {
+namespace Core {
+namespace Log {
+
+// Capacité de la file : au-delà, les enregistrements sont comptés puis abandonnés
+static constexpr std::size_t kQueueCapacity = 1 << 16;
+
+// 🖥 MISE EN FORME TEXTE - le nom de l'entité n'est construit qu'ici, sur le thread de vidage
+void StreamSink::Consume(const Record& record) {
+    mStream << "[" << LevelName(record.level) << "] ";
+    const std::string entity = FormatEntityId(record.entityId);
+    switch (record.event) {
+        case Event::ENTITY_CREATED:
+            mStream << "🌱 Entité créée: " << entity
+                    << " à (" << record.values[0] << ", " << record.values[1] << ")";
+            break;
+        case Event::ENTITY_BORN:
+            mStream << "👶 Naissance: " << entity << " (énergie " << record.values[0] << ")";
+            break;
+        case Event::ENTITY_DESTROYED:
+            mStream << "💀 Entité détruite: " << entity << " (Âge: " << record.integer << ")";
+            break;
+        case Event::ENTITY_ATE:
+            mStream << "🍽 " << entity << " mange et gagne " << record.values[0] << " énergie";
+            break;
+        case Event::ENTITY_STARVED:
+            mStream << "💀 " << entity << " meurt - Faim";
+            break;
+        case Event::ENTITY_DIED_OF_AGE:
+            mStream << "💀 " << entity << " meurt - Vieillesse";
+            break;
+    }
+    mStream << '\n';
+}
+
+// 🏗 CONSTRUCTEUR - le thread de vidage démarre avec le journal
+Logger::Logger()
+    : mQueue(kQueueCapacity), mHasSinks(false),
+      mLevel(static_cast<uint8_t>(Level::TRACE)), mDropped(0), mRunning(true)
+{
+    mDrainThread = std::thread(&Logger::DrainLoop, this);
+}
+
+// 🗑 DESTRUCTEUR - vide ce qui reste avant de s'arrêter
+Logger::~Logger() {
+    mRunning.store(false, std::memory_order_relaxed);
+    mDrainThread.join();
+    Flush();
+}
+
+Logger& Logger::Instance() {
+    static Logger instance;
+    return instance;
+}
+
+// ⚙️ AJOUT D'UN PUITS
+void Logger::AddSink(std::unique_ptr<Sink> sink) {
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+    mSinks.push_back(std::move(sink));
+    mHasSinks.store(true, std::memory_order_release);
+}
+
+// 🚿 VIDAGE SYNCHRONE
+void Logger::Flush() {
+    while (DrainOnce()) {
+    }
+}
+
+// ✍️ ÉMISSION
+void Logger::Write(Level level, Event event, uint64_t entityId, float value0, float value1, int32_t integer) {
+    if (!mHasSinks.load(std::memory_order_relaxed) ||
+        static_cast<uint8_t>(level) < mLevel.load(std::memory_order_relaxed)) {
+        return;
+    }
+    Record record;
+    record.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    record.entityId = entityId;
+    record.values[0] = value0;
+    record.values[1] = value1;
+    record.integer = integer;
+    record.level = level;
+    record.event = event;
+    if (!mQueue.TryPush(record)) {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// 🔁 BOUCLE DU THREAD DE VIDAGE
+void Logger::DrainLoop() {
+    while (mRunning.load(std::memory_order_relaxed)) {
+        if (!DrainOnce()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+// 📤 Vide un lot d'enregistrements vers les puits, renvoie false si la file était vide
+// Le verrou garantit un seul consommateur à la fois (thread de vidage ou Flush)
+bool Logger::DrainOnce() {
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+    Record record;
+    std::size_t drained = 0;
+    while (drained < 1024 && mQueue.TryPop(record)) {
+        for (auto& sink : mSinks) {
+            sink->Consume(record);
+        }
+        ++drained;
+    }
+    return drained > 0;
+}
+
+// 🏷 NOM D'UN NIVEAU
+const char* LevelName(Level level) {
+    switch (level) {
+        case Level::TRACE: return "TRACE";
+        case Level::DEBUG: return "DEBUG";
+        case Level::INFO: return "INFO";
+        case Level::WARNING: return "WARN";
+        case Level::ERROR: return "ERROR";
+    }
+    return "?";
+}
+
+} // namespace Log
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,325 @@
+#include "Core/MotionKernel.hpp"
+#include "Core/Log.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+// Les chemins SIMD ne sont compilés que pour x86 avec GCC/Clang : chaque
+// fonction active son jeu d'instructions via un attribut `target`, le reste
+// du programme restant compilé pour le processeur de base.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ECOSYSTEM_MOTION_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+namespace Motion {
+
+// 🔧 CONSTANTES DU MOUVEMENT
+static constexpr float kMoveScale = 20.0f;   // Pixels par unité de vitesse et par seconde
+static constexpr float kMoveCost = 0.1f;     // Énergie par unité de vitesse et par seconde
+
+static_assert(sizeof(std::array<float, 4>) == 4 * sizeof(float), "tirages du tick contigus attendus");
+
+// 🎲 NOUVELLE DIRECTION - tirages 1 et 2 du tick ramenés dans [-1, 1)
+static void Turn(EntityStore& store, std::size_t index) {
+    const std::array<float, 4>& random = store.uniforms[index];
+    float velocityX = random[1] * 2.0f - 1.0f;
+    float velocityY = random[2] * 2.0f - 1.0f;
+    store.velocityX[index] = velocityX;
+    store.velocityY[index] = velocityY;
+    store.speed[index] = std::sqrt(velocityX * velocityX + velocityY * velocityY);
+}
+
+// 💀 MORT DE FAIM - la mort par l'âge est un événement daté (voir Core/TimingWheel)
+static void Kill(EntityStore& store, std::size_t index) {
+    store.alive[index] = 0;
+    ECOSYSTEM_LOG_DEBUG(Log::Event::ENTITY_STARVED, store.id[index], store.energy[index], 0.0f, store.age[index]);
+}
+
+// 🧮 CHEMIN SCALAIRE - référence bit à bit des chemins vectoriels
+// Une opération par instruction : aucune contraction en FMA n'est possible.
+// Chaque chemin est instancié pour les espèces mobiles et pour les autres
+// (voir SpeciesTraits::kMobile) : aucun test d'espèce par entité.
+template <bool Mobile>
+static bool AdvanceOne(EntityStore& store, std::size_t i, float deltaTime, int ageStep) {
+    if (!store.alive[i]) return false;
+
+    float consumed = store.metabolism[i] * deltaTime;
+    float energy = store.energy[i] - consumed;
+    store.age[i] += ageStep;
+
+    // Les espèces immobiles n'exécutent pas ce code
+    if constexpr (Mobile) {
+        if (store.uniforms[i][0] < kTurnChance) {
+            Turn(store, i);
+        }
+        float stepX = store.velocityX[i] * deltaTime;
+        float stepY = store.velocityY[i] * deltaTime;
+        stepX = stepX * kMoveScale;
+        stepY = stepY * kMoveScale;
+        store.positionX[i] = store.positionX[i] + stepX;
+        store.positionY[i] = store.positionY[i] + stepY;
+
+        float cost = store.speed[i] * deltaTime;
+        cost = cost * kMoveCost;
+        energy = energy - cost;
+    }
+    store.energy[i] = energy;
+
+    if (energy <= 0.0f) {
+        Kill(store, i);
+        return true;
+    }
+    return false;
+}
+
+template <bool Mobile>
+static std::size_t AdvanceScalar(EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    const int ageStep = AgeStep(deltaTime);
+    std::size_t deaths = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        deaths += AdvanceOne<Mobile>(store, i, deltaTime, ageStep);
+    }
+    return deaths;
+}
+
+#ifdef ECOSYSTEM_MOTION_X86
+
+// 🚀 CHEMIN SSE2 - 4 entités par itération
+__attribute__((target("sse2")))
+static __m128i WidenBytes4(const uint8_t* bytes) {
+    int32_t packed;
+    std::memcpy(&packed, bytes, sizeof(packed));
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+}
+
+__attribute__((target("sse2")))
+static __m128 Select4(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+template <bool Mobile>
+__attribute__((target("sse2")))
+static std::size_t AdvanceSse2(EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    const int ageStep = AgeStep(deltaTime);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 moveScale = _mm_set1_ps(kMoveScale);
+    const __m128 moveCost = _mm_set1_ps(kMoveCost);
+    const __m128 turnChance = _mm_set1_ps(kTurnChance);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128i zeroInt = _mm_setzero_si128();
+    const __m128i step = _mm_set1_epi32(ageStep);
+    const __m128i allOnes = _mm_cmpeq_epi32(zeroInt, zeroInt);
+
+    const uint8_t* alive = store.alive.data();
+    std::size_t deaths = 0;
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        // 🎭 Masque de vie
+        __m128i isDead = _mm_cmpeq_epi32(WidenBytes4(alive + i), zeroInt);
+        __m128 aliveMask = _mm_castsi128_ps(_mm_xor_si128(isDead, allOnes));
+
+        // 🎲 Changements de direction (rares), appliqués avant le calcul vectoriel
+        if constexpr (Mobile) {
+            __m128 firstDraw = _mm_setr_ps(store.uniforms[i][0], store.uniforms[i + 1][0],
+                                           store.uniforms[i + 2][0], store.uniforms[i + 3][0]);
+            int turning = _mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(firstDraw, turnChance), aliveMask));
+            while (turning) {
+                Turn(store, i + __builtin_ctz(turning));
+                turning &= turning - 1;
+            }
+        }
+
+        // 🔄 Métabolisme et vieillissement
+        __m128 energy = _mm_loadu_ps(&store.energy[i]);
+        energy = Select4(aliveMask, _mm_sub_ps(energy, _mm_mul_ps(_mm_loadu_ps(&store.metabolism[i]), dt)), energy);
+        __m128i age = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&store.age[i]));
+        age = _mm_add_epi32(age, _mm_and_si128(step, _mm_castps_si128(aliveMask)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&store.age[i]), age);
+
+        // 📐 Déplacement et coût du mouvement
+        if constexpr (Mobile) {
+            __m128 stepX = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&store.velocityX[i]), dt), moveScale);
+            __m128 stepY = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&store.velocityY[i]), dt), moveScale);
+            __m128 positionX = _mm_loadu_ps(&store.positionX[i]);
+            __m128 positionY = _mm_loadu_ps(&store.positionY[i]);
+            _mm_storeu_ps(&store.positionX[i], Select4(aliveMask, _mm_add_ps(positionX, stepX), positionX));
+            _mm_storeu_ps(&store.positionY[i], Select4(aliveMask, _mm_add_ps(positionY, stepY), positionY));
+            __m128 cost = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&store.speed[i]), dt), moveCost);
+            energy = Select4(aliveMask, _mm_sub_ps(energy, cost), energy);
+        }
+        _mm_storeu_ps(&store.energy[i], energy);
+
+        // ❤️ Masque de vie : faim
+        int dying = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(energy, zero), aliveMask));
+        while (dying) {
+            Kill(store, i + __builtin_ctz(dying));
+            dying &= dying - 1;
+            ++deaths;
+        }
+    }
+    for (; i < end; ++i) {
+        deaths += AdvanceOne<Mobile>(store, i, deltaTime, ageStep);
+    }
+    return deaths;
+}
+
+// 🚀 CHEMIN AVX2 - 8 entités par itération
+__attribute__((target("avx2")))
+static __m256i WidenBytes8(const uint8_t* bytes) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes)));
+}
+
+template <bool Mobile>
+__attribute__((target("avx2")))
+static std::size_t AdvanceAvx2(EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    const int ageStep = AgeStep(deltaTime);
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 moveScale = _mm256_set1_ps(kMoveScale);
+    const __m256 moveCost = _mm256_set1_ps(kMoveCost);
+    const __m256 turnChance = _mm256_set1_ps(kTurnChance);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i zeroInt = _mm256_setzero_si256();
+    const __m256i step = _mm256_set1_epi32(ageStep);
+    const __m256i drawStride = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+
+    const uint8_t* alive = store.alive.data();
+    std::size_t deaths = 0;
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        // 🎭 Masque de vie
+        __m256i isDead = _mm256_cmpeq_epi32(WidenBytes8(alive + i), zeroInt);
+        __m256 aliveMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(isDead, zeroInt));
+
+        // 🎲 Changements de direction (rares), appliqués avant le calcul vectoriel
+        if constexpr (Mobile) {
+            __m256 firstDraw = _mm256_i32gather_ps(store.uniforms[i].data(), drawStride, 4);
+            int turning = _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(firstDraw, turnChance, _CMP_LT_OQ), aliveMask));
+            while (turning) {
+                Turn(store, i + __builtin_ctz(turning));
+                turning &= turning - 1;
+            }
+        }
+
+        // 🔄 Métabolisme et vieillissement
+        __m256 energy = _mm256_loadu_ps(&store.energy[i]);
+        energy = _mm256_blendv_ps(energy, _mm256_sub_ps(energy, _mm256_mul_ps(_mm256_loadu_ps(&store.metabolism[i]), dt)), aliveMask);
+        __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&store.age[i]));
+        age = _mm256_add_epi32(age, _mm256_and_si256(step, _mm256_castps_si256(aliveMask)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&store.age[i]), age);
+
+        // 📐 Déplacement et coût du mouvement
+        if constexpr (Mobile) {
+            __m256 stepX = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&store.velocityX[i]), dt), moveScale);
+            __m256 stepY = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&store.velocityY[i]), dt), moveScale);
+            __m256 positionX = _mm256_loadu_ps(&store.positionX[i]);
+            __m256 positionY = _mm256_loadu_ps(&store.positionY[i]);
+            _mm256_storeu_ps(&store.positionX[i], _mm256_blendv_ps(positionX, _mm256_add_ps(positionX, stepX), aliveMask));
+            _mm256_storeu_ps(&store.positionY[i], _mm256_blendv_ps(positionY, _mm256_add_ps(positionY, stepY), aliveMask));
+            __m256 cost = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&store.speed[i]), dt), moveCost);
+            energy = _mm256_blendv_ps(energy, _mm256_sub_ps(energy, cost), aliveMask);
+        }
+        _mm256_storeu_ps(&store.energy[i], energy);
+
+        // ❤️ Masque de vie : faim
+        int dying = _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(energy, zero, _CMP_LE_OQ), aliveMask));
+        while (dying) {
+            Kill(store, i + __builtin_ctz(dying));
+            dying &= dying - 1;
+            ++deaths;
+        }
+    }
+    for (; i < end; ++i) {
+        deaths += AdvanceOne<Mobile>(store, i, deltaTime, ageStep);
+    }
+    return deaths;
+}
+
+#endif // ECOSYSTEM_MOTION_X86
+
+// 🔍 SUPPORT PAR LE PROCESSEUR
+bool IsSupported(Path path) {
+    switch (path) {
+        case Path::SCALAR:
+            return true;
+#ifdef ECOSYSTEM_MOTION_X86
+        case Path::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case Path::AVX2:
+            return __builtin_cpu_supports("avx2");
+#else
+        case Path::SSE2:
+        case Path::AVX2:
+            return false;
+#endif
+    }
+    return false;
+}
+
+Path GetBestPath() {
+    if (IsSupported(Path::AVX2)) return Path::AVX2;
+    if (IsSupported(Path::SSE2)) return Path::SSE2;
+    return Path::SCALAR;
+}
+
+const char* PathName(Path path) {
+    switch (path) {
+        case Path::SCALAR: return "scalar";
+        case Path::SSE2: return "sse2";
+        case Path::AVX2: return "avx2";
+    }
+    return "?";
+}
+
+// ⚙️ CHEMIN ACTIF - choisi une fois au premier usage
+static std::atomic<Path>& ActivePath() {
+    static std::atomic<Path> path(GetBestPath());
+    return path;
+}
+
+Path GetActivePath() {
+    return ActivePath().load(std::memory_order_relaxed);
+}
+
+bool SetActivePath(Path path) {
+    if (!IsSupported(path)) return false;
+    ActivePath().store(path, std::memory_order_relaxed);
+    return true;
+}
+
+// 🔄 AVANCE
+std::size_t Advance(EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    return Advance(GetActivePath(), store, begin, end, deltaTime);
+}
+
+// Plage d'une seule espèce : chemin choisi, instancié selon sa mobilité
+template <bool Mobile>
+static std::size_t AdvanceSpecies(Path path, EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    switch (path) {
+#ifdef ECOSYSTEM_MOTION_X86
+        case Path::SSE2:
+            return AdvanceSse2<Mobile>(store, begin, end, deltaTime);
+        case Path::AVX2:
+            return AdvanceAvx2<Mobile>(store, begin, end, deltaTime);
+#endif
+        default:
+            return AdvanceScalar<Mobile>(store, begin, end, deltaTime);
+    }
+}
+
+std::size_t Advance(Path path, EntityStore& store, std::size_t begin, std::size_t end, float deltaTime) {
+    std::size_t deaths = 0;
+    store.ForEachSpeciesRange(begin, end, [&](auto species, std::size_t from, std::size_t to) {
+        if constexpr (!TraitsOf<decltype(species)>::kLazy) {
+            deaths += AdvanceSpecies<TraitsOf<decltype(species)>::kMobile>(path, store, from, to, deltaTime);
+        }
+    });
+    return deaths;
+}
+
+} // namespace Motion
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,154 @@
+#include "Core/Profiler.hpp"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+namespace Ecosystem {
+namespace Core {
+namespace Profiler {
+
+// Au-delà, les zones d'un thread sont comptées comme perdues jusqu'au prochain relevé
+static constexpr std::size_t kMaxEventsPerThread = 1 << 20;
+
+// 🧵 TAMPON D'UN THREAD - écrit par son seul propriétaire
+struct ThreadBuffer {
+    std::vector<Event> events;
+    uint32_t thread = 0;
+    uint64_t dropped = 0;
+    bool retired = false;  // Thread terminé : libéré au prochain relevé
+};
+
+// Le registre possède les tampons : un thread qui se termine n'invalide
+// pas les zones qu'il a enregistrées et qui n'ont pas encore été relevées
+static std::mutex gRegistryMutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> gBuffers;
+static std::vector<const char*> gThreadNames;  // Par numéro de thread, pour l'export
+static uint64_t gDropped = 0;
+static std::atomic<bool> gCapturing(false);
+
+struct ThreadHandle {
+    ThreadBuffer* buffer = nullptr;
+    ~ThreadHandle() {
+        if (!buffer) return;
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        buffer->retired = true;
+    }
+};
+static thread_local ThreadHandle tHandle;
+
+static ThreadBuffer& LocalBuffer() {
+    if (!tHandle.buffer) {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        gBuffers.push_back(std::make_unique<ThreadBuffer>());
+        tHandle.buffer = gBuffers.back().get();
+        tHandle.buffer->thread = static_cast<uint32_t>(gThreadNames.size());
+        gThreadNames.push_back(nullptr);
+    }
+    return *tHandle.buffer;
+}
+
+// 🕒 HORLOGE
+uint64_t Now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// 🎬 CAPTURE
+void SetCapturing(bool capturing) {
+    gCapturing.store(capturing, std::memory_order_relaxed);
+}
+
+bool IsCapturing() {
+    return gCapturing.load(std::memory_order_relaxed);
+}
+
+// ✍️ ENREGISTREMENT
+void Record(const char* name, uint64_t start, uint64_t end) {
+    ThreadBuffer& buffer = LocalBuffer();
+    if (buffer.events.size() >= kMaxEventsPerThread) {
+        buffer.dropped++;
+        return;
+    }
+    buffer.events.push_back({name, start, end > start ? end - start : 0, buffer.thread});
+}
+
+void SetThreadName(const char* name) {
+    ThreadBuffer& buffer = LocalBuffer();
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    gThreadNames[buffer.thread] = name;
+}
+
+// 📥 RELEVÉ
+void Collect(std::vector<Event>& out) {
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    for (std::size_t i = 0; i < gBuffers.size();) {
+        ThreadBuffer& buffer = *gBuffers[i];
+        out.insert(out.end(), buffer.events.begin(), buffer.events.end());
+        buffer.events.clear();
+        gDropped += buffer.dropped;
+        buffer.dropped = 0;
+        if (buffer.retired) {
+            gBuffers[i] = std::move(gBuffers.back());
+            gBuffers.pop_back();
+        } else {
+            ++i;
+        }
+    }
+}
+
+uint64_t GetDroppedCount() {
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    return gDropped;
+}
+
+// 💾 EXPORT CHROME TRACE
+// Événements complets ("ph":"X") en microsecondes, relatifs à la première zone ;
+// les noms de threads sont des métadonnées ("ph":"M")
+bool WriteChromeTrace(const std::string& path, const std::vector<Event>& events) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "❌ Impossible de créer la trace: " << path << std::endl;
+        return false;
+    }
+
+    uint64_t origin = events.empty() ? 0 : events.front().start;
+    for (const Event& event : events) {
+        if (event.start < origin) origin = event.start;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        for (std::size_t thread = 0; thread < gThreadNames.size(); ++thread) {
+            if (!gThreadNames[thread]) continue;
+            file << (first ? "" : ",\n")
+                 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+                 << ",\"args\":{\"name\":\"" << gThreadNames[thread] << "\"}}";
+            first = false;
+        }
+    }
+    file.setf(std::ios::fixed);
+    file.precision(3);
+    for (const Event& event : events) {
+        file << (first ? "" : ",\n")
+             << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+             << ",\"ts\":" << static_cast<double>(event.start - origin) / 1000.0
+             << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+        first = false;
+    }
+    file << "\n]}\n";
+
+    if (!file) {
+        std::cerr << "❌ Erreur d'écriture de la trace: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace Profiler
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,17 @@
+#include "Core/Random.hpp"
+
+namespace Ecosystem {
+namespace Core {
+namespace Random {
+
+// 📦 REMPLISSAGE PAR LOTS
+void FillUniforms(uint64_t seed, const uint64_t* entityIds, std::size_t count,
+                  uint64_t tick, Stream stream, std::array<float, 4>* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = Uniforms(seed, entityIds[i], tick, stream);
+    }
+}
+
+} // namespace Random
+} // namespace Core
+} // namespace Ecosystem
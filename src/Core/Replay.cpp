@@ -0,0 +1,238 @@
+#include "Core/Replay.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+namespace Replay {
+
+// 🏷 FORMAT DU JOURNAL
+static constexpr char kMagic[8] = {'E', 'C', 'O', 'R', 'E', 'P', 'L', 'Y'};
+static constexpr uint32_t kVersion = 1;
+
+// Chaque entrée commence par son étiquette
+enum class Tag : uint8_t {
+    TICK = 0,
+    TICK_HASH = 1,  // Suivie de l'empreinte (8 octets)
+    INPUT = 2       // Suivie de la commande, de amount et du chemin
+};
+
+struct FileHeader {
+    uint32_t seed;
+    float deltaTime;
+    float worldWidth;
+    float worldHeight;
+    int32_t maxEntities;
+    int32_t population[kSpeciesCount];
+    uint32_t hashInterval;
+    uint32_t loadPathLength;
+};
+
+template <typename T>
+static void WriteValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool ReadValue(std::ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// ▶️ DÉPART
+bool Start(Ecosystem& ecosystem, const RunConfig& config) {
+    if (!config.loadPath.empty()) {
+        return ecosystem.LoadSnapshot(config.loadPath);
+    }
+    ecosystem.Initialize(config.population[0], config.population[1], config.population[2]);
+    return true;
+}
+
+// ⌨️ COMMANDE
+bool Apply(Ecosystem& ecosystem, const RunConfig& config, const Input& input) {
+    switch (input.command) {
+        case Command::RESET:
+            ecosystem.Initialize(config.population[0], config.population[1], config.population[2]);
+            return true;
+        case Command::SPAWN_FOOD:
+            ecosystem.SpawnFood(static_cast<int>(input.amount));
+            return true;
+        case Command::LOAD_SNAPSHOT:
+            return ecosystem.LoadSnapshot(input.path);
+    }
+    return false;
+}
+
+// 🏗 CONSTRUCTEUR/DESTRUCTEUR
+Recorder::Recorder()
+    : mTick(0), mHashInterval(1)
+{
+}
+
+Recorder::~Recorder() {
+    Close();
+}
+
+// 💾 OUVERTURE - en-tête : magie, version, configuration
+bool Recorder::Open(const std::string& path, const RunConfig& config) {
+    Close();
+    mFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!mFile) {
+        std::cerr << "❌ Impossible de créer le journal de rejeu: " << path << std::endl;
+        return false;
+    }
+    mPath = path;
+    mTick = 0;
+    mHashInterval = config.hashInterval > 0 ? config.hashInterval : 1;
+
+    FileHeader header = {};
+    header.seed = config.seed;
+    header.deltaTime = config.deltaTime;
+    header.worldWidth = config.worldWidth;
+    header.worldHeight = config.worldHeight;
+    header.maxEntities = config.maxEntities;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        header.population[species] = config.population[species];
+    }
+    header.hashInterval = mHashInterval;
+    header.loadPathLength = static_cast<uint32_t>(config.loadPath.size());
+    mFile.write(kMagic, sizeof(kMagic));
+    WriteValue(mFile, kVersion);
+    WriteValue(mFile, header);
+    mFile.write(config.loadPath.data(), static_cast<std::streamsize>(config.loadPath.size()));
+    return static_cast<bool>(mFile);
+}
+
+// 🔒 FERMETURE
+void Recorder::Close() {
+    if (!mFile.is_open()) return;
+    mFile.close();
+    std::cout << "🎬 Journal de rejeu écrit: " << mPath << " (" << mTick << " ticks)" << std::endl;
+}
+
+// 📝 ENREGISTREMENT
+void Recorder::RecordInput(Command command, uint32_t amount, const std::string& path) {
+    if (!mFile.is_open()) return;
+    uint16_t pathLength = static_cast<uint16_t>(path.size());
+    WriteValue(mFile, Tag::INPUT);
+    WriteValue(mFile, command);
+    WriteValue(mFile, amount);
+    WriteValue(mFile, pathLength);
+    mFile.write(path.data(), pathLength);
+}
+
+void Recorder::RecordTick(const Ecosystem& ecosystem) {
+    if (!mFile.is_open()) return;
+    if (mTick % mHashInterval == 0) {
+        WriteValue(mFile, Tag::TICK_HASH);
+        WriteValue(mFile, ecosystem.ComputeStateHash());
+    } else {
+        WriteValue(mFile, Tag::TICK);
+    }
+    ++mTick;
+}
+
+// 📖 LECTURE
+bool Load(const std::string& path, Log& log) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "❌ Journal de rejeu introuvable: " << path << std::endl;
+        return false;
+    }
+
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    FileHeader header = {};
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !ReadValue(file, version) || version != kVersion || !ReadValue(file, header)) {
+        std::cerr << "❌ Journal de rejeu invalide: " << path << std::endl;
+        return false;
+    }
+
+    log = Log();
+    log.config.seed = header.seed;
+    log.config.deltaTime = header.deltaTime;
+    log.config.worldWidth = header.worldWidth;
+    log.config.worldHeight = header.worldHeight;
+    log.config.maxEntities = header.maxEntities;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        log.config.population[species] = header.population[species];
+    }
+    log.config.hashInterval = header.hashInterval;
+    log.config.loadPath.resize(header.loadPathLength);
+    file.read(&log.config.loadPath[0], header.loadPathLength);
+
+    // Entrées jusqu'à la fin du fichier ; une entrée tronquée (arrêt brutal) est ignorée
+    Tag tag;
+    while (file && ReadValue(file, tag)) {
+        if (tag == Tag::TICK) {
+            ++log.ticks;
+        } else if (tag == Tag::TICK_HASH) {
+            uint64_t hash = 0;
+            if (!ReadValue(file, hash)) break;
+            log.hashes.emplace_back(log.ticks++, hash);
+        } else if (tag == Tag::INPUT) {
+            Input input;
+            uint16_t pathLength = 0;
+            input.tick = log.ticks;
+            if (!ReadValue(file, input.command) || !ReadValue(file, input.amount) ||
+                !ReadValue(file, pathLength)) {
+                break;
+            }
+            input.path.resize(pathLength);
+            if (!file.read(&input.path[0], pathLength)) break;
+            log.inputs.push_back(input);
+        } else {
+            std::cerr << "❌ Entrée de rejeu inconnue dans " << path << " après " << log.ticks << " ticks" << std::endl;
+            return false;
+        }
+    }
+    if (log.config.deltaTime <= 0.0f || log.config.worldWidth <= 0.0f || log.config.worldHeight <= 0.0f) {
+        std::cerr << "❌ Configuration de rejeu invalide: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ⏩ REJEU
+bool Run(const Log& log, std::size_t threadCount, Result& result) {
+    const RunConfig& config = log.config;
+    Ecosystem ecosystem(config.worldWidth, config.worldHeight, config.maxEntities, config.seed, false);
+    ecosystem.SetThreadCount(threadCount);
+    if (!Start(ecosystem, config)) {
+        return false;
+    }
+
+    result = Result();
+    auto start = std::chrono::steady_clock::now();
+    std::size_t nextInput = 0;
+    std::size_t nextHash = 0;
+    for (uint64_t tick = 0; tick < log.ticks; ++tick) {
+        // Une commande en échec (instantané disparu) laisse l'état inchangé, comme
+        // à l'enregistrement ; si elle avait réussi alors, l'empreinte le signalera
+        for (; nextInput < log.inputs.size() && log.inputs[nextInput].tick == tick; ++nextInput) {
+            Apply(ecosystem, config, log.inputs[nextInput]);
+        }
+        ecosystem.Update(config.deltaTime);
+        result.ticks = tick + 1;
+
+        if (nextHash < log.hashes.size() && log.hashes[nextHash].first == tick) {
+            uint64_t hash = ecosystem.ComputeStateHash();
+            if (hash != log.hashes[nextHash].second) {
+                result.diverged = true;
+                result.divergentTick = tick;
+                result.expectedHash = log.hashes[nextHash].second;
+                result.actualHash = hash;
+                break;
+            }
+            ++nextHash;
+        }
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+} // namespace Replay
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,186 @@
+#include "Core/Snapshot.hpp"
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Le format d'instantané suppose une machine petit-boutiste"
+#endif
+
+namespace Ecosystem {
+namespace Core {
+namespace Snapshot {
+
+static std::size_t AlignUp(std::size_t offset) {
+    return (offset + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+// ➕ AJOUT D'UNE SECTION
+void Writer::Add(Section id, const void* data, std::size_t elementSize, std::size_t count) {
+    mSections.push_back({id, data, elementSize, count});
+}
+
+void Writer::AddCopy(Section id, const void* data, std::size_t elementSize, std::size_t count) {
+    const char* bytes = static_cast<const char*>(data);
+    mOwnedData.emplace_back(bytes, bytes + elementSize * count);
+    Add(id, mOwnedData.back().data(), elementSize, count);
+}
+
+// 💾 ÉCRITURE DU FICHIER
+bool Writer::WriteFile(const std::string& path) const {
+    // 📐 Disposition : en-tête, table, puis chaque section alignée
+    std::vector<SectionEntry> table(mSections.size());
+    std::size_t offset = AlignUp(sizeof(FileHeader) + table.size() * sizeof(SectionEntry));
+    for (std::size_t i = 0; i < mSections.size(); ++i) {
+        table[i].id = static_cast<uint32_t>(mSections[i].id);
+        table[i].elementSize = static_cast<uint32_t>(mSections[i].elementSize);
+        table[i].count = mSections[i].count;
+        table[i].offset = offset;
+        offset = AlignUp(offset + mSections[i].elementSize * mSections[i].count);
+    }
+
+    FileHeader header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byteOrder = kByteOrderMark;
+    header.sectionCount = static_cast<uint32_t>(table.size());
+    header.fileSize = offset;
+
+    std::string temporaryPath = path + ".tmp";
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "❌ Impossible de créer l'instantané: " << temporaryPath << std::endl;
+        return false;
+    }
+
+    static const char padding[kSectionAlignment] = {};
+    std::size_t written = 0;
+    auto pad = [&](std::size_t target) {
+        file.write(padding, static_cast<std::streamsize>(target - written));
+        written = target;
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()),
+               static_cast<std::streamsize>(table.size() * sizeof(SectionEntry)));
+    written = sizeof(header) + table.size() * sizeof(SectionEntry);
+    for (std::size_t i = 0; i < mSections.size(); ++i) {
+        pad(table[i].offset);
+        std::size_t bytes = mSections[i].elementSize * mSections[i].count;
+        file.write(static_cast<const char*>(mSections[i].data), static_cast<std::streamsize>(bytes));
+        written += bytes;
+    }
+    pad(offset);
+
+    file.close();
+    if (!file) {
+        std::cerr << "❌ Erreur d'écriture de l'instantané: " << temporaryPath << std::endl;
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::cerr << "❌ Impossible de remplacer l'instantané: " << path << std::endl;
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// 🏗 CONSTRUCTEUR / DESTRUCTEUR
+Reader::Reader() : mMapping(nullptr), mSize(0), mSections(nullptr), mSectionCount(0) {}
+
+Reader::~Reader() {
+    Close();
+}
+
+void Reader::Close() {
+    if (mMapping) {
+        munmap(mMapping, mSize);
+    }
+    mMapping = nullptr;
+    mSize = 0;
+    mSections = nullptr;
+    mSectionCount = 0;
+}
+
+// 📖 OUVERTURE ET VALIDATION
+bool Reader::Open(const std::string& path) {
+    Close();
+
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        std::cerr << "❌ Instantané introuvable: " << path << std::endl;
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(FileHeader)) {
+        std::cerr << "❌ Instantané invalide: " << path << std::endl;
+        close(descriptor);
+        return false;
+    }
+    mSize = static_cast<std::size_t>(status.st_size);
+    void* mapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);  // La projection reste valide après fermeture
+    if (mapping == MAP_FAILED) {
+        std::cerr << "❌ Projection en mémoire impossible: " << path << std::endl;
+        mSize = 0;
+        return false;
+    }
+    mMapping = mapping;
+    madvise(mMapping, mSize, MADV_SEQUENTIAL);
+
+    // 🔍 En-tête
+    FileHeader header;
+    std::memcpy(&header, mMapping, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.byteOrder != kByteOrderMark) {
+        std::cerr << "❌ Ce fichier n'est pas un instantané d'écosystème: " << path << std::endl;
+        Close();
+        return false;
+    }
+    if (header.version != kVersion) {
+        std::cerr << "❌ Version d'instantané non supportée: " << header.version
+                  << " (attendue " << kVersion << ")" << std::endl;
+        Close();
+        return false;
+    }
+    std::size_t tableEnd = sizeof(FileHeader) + static_cast<std::size_t>(header.sectionCount) * sizeof(SectionEntry);
+    if (header.fileSize != mSize || tableEnd > mSize) {
+        std::cerr << "❌ Instantané tronqué: " << path << std::endl;
+        Close();
+        return false;
+    }
+
+    // 🔍 Chaque section doit tenir dans le fichier
+    mSections = reinterpret_cast<const SectionEntry*>(static_cast<const char*>(mMapping) + sizeof(FileHeader));
+    mSectionCount = header.sectionCount;
+    for (uint32_t i = 0; i < mSectionCount; ++i) {
+        const SectionEntry& entry = mSections[i];
+        if (entry.offset > mSize ||
+            (entry.elementSize != 0 && entry.count > (mSize - entry.offset) / entry.elementSize)) {
+            std::cerr << "❌ Section " << entry.id << " hors du fichier: " << path << std::endl;
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+// 🔍 RECHERCHE D'UNE SECTION
+const void* Reader::Find(Section id, std::size_t elementSize, std::size_t& count) const {
+    for (uint32_t i = 0; i < mSectionCount; ++i) {
+        const SectionEntry& entry = mSections[i];
+        if (entry.id != static_cast<uint32_t>(id)) continue;
+        if (entry.elementSize != elementSize) return nullptr;
+        count = static_cast<std::size_t>(entry.count);
+        return static_cast<const char*>(mMapping) + entry.offset;
+    }
+    return nullptr;
+}
+
+} // namespace Snapshot
+} // namespace Core
+} // namespace Ecosystem
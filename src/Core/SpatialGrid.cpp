@@ -0,0 +1,166 @@
+#include "Core/SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+SpatialGrid::SpatialGrid(float width, float height, float cellSize)
+    : mCellSize(1.0f), mInverseCellSize(1.0f), mColumns(1), mRows(1)
+{
+    Resize(width, height, cellSize);
+}
+
+// 📐 REDIMENSIONNEMENT
+void SpatialGrid::Resize(float width, float height, float cellSize) {
+    mCellSize = std::max(cellSize, 1.0f);
+    mInverseCellSize = 1.0f / mCellSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(width * mInverseCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(height * mInverseCellSize)));
+    mCellStart.assign(static_cast<std::size_t>(mColumns) * mRows + 1, 0);
+    mEntries.clear();
+    mPending.clear();
+    mPendingCell.clear();
+    mCellCursor.clear();
+}
+
+// 🧹 VIDAGE
+void SpatialGrid::Clear() {
+    mPending.clear();
+    mPendingCell.clear();
+}
+
+// ➕ INSERTION (prise en compte au prochain Build)
+void SpatialGrid::Insert(uint32_t id, float x, float y) {
+    mPending.push_back({id, x, y});
+    mPendingCell.push_back(static_cast<uint32_t>(CellRow(y) * mColumns + CellColumn(x)));
+}
+
+// ⚙️ CONSTRUCTION - tri par comptage des points en attente
+void SpatialGrid::Build() {
+    std::fill(mCellStart.begin(), mCellStart.end(), 0);
+    for (uint32_t cell : mPendingCell) {
+        mCellStart[cell + 1]++;
+    }
+    for (std::size_t i = 1; i < mCellStart.size(); ++i) {
+        mCellStart[i] += mCellStart[i - 1];
+    }
+
+    // Curseur d'écriture par cellule, initialisé au début de chaque cellule
+    mCellCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+    mEntries.resize(mPending.size());
+    for (std::size_t i = 0; i < mPending.size(); ++i) {
+        mEntries[mCellCursor[mPendingCell[i]]++] = mPending[i];
+    }
+
+    mPending.clear();
+    mPendingCell.clear();
+}
+
+// 🔍 REQUÊTE PAR RAYON
+std::size_t SpatialGrid::QueryRadius(Vector2D center, float radius, Neighbor* out, std::size_t maxResults) const {
+    if (maxResults == 0 || mEntries.empty()) return 0;
+
+    float radiusSquared = radius * radius;
+    int minColumn = CellColumn(center.x - radius);
+    int maxColumn = CellColumn(center.x + radius);
+    int minRow = CellRow(center.y - radius);
+    int maxRow = CellRow(center.y + radius);
+
+    std::size_t found = 0;
+    for (int row = minRow; row <= maxRow; ++row) {
+        for (int column = minColumn; column <= maxColumn; ++column) {
+            std::size_t cell = static_cast<std::size_t>(row) * mColumns + column;
+            for (uint32_t i = mCellStart[cell]; i < mCellStart[cell + 1]; ++i) {
+                const Entry& entry = mEntries[i];
+                float dx = entry.x - center.x;
+                float dy = entry.y - center.y;
+                float distanceSquared = dx * dx + dy * dy;
+                if (distanceSquared <= radiusSquared) {
+                    out[found++] = {entry.id, entry.x, entry.y, distanceSquared};
+                    if (found == maxResults) return found;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+// 🔍 REQUÊTE DES K PLUS PROCHES VOISINS
+// Recherche par anneaux de cellules croissants autour du centre
+std::size_t SpatialGrid::QueryNearest(Vector2D center, std::size_t k, float maxRadius, Neighbor* out) const {
+    if (k == 0 || mEntries.empty()) return 0;
+
+    float maxRadiusSquared = maxRadius * maxRadius;
+    int centerColumn = CellColumn(center.x);
+    int centerRow = CellRow(center.y);
+    int maxRing = static_cast<int>(std::ceil(maxRadius * mInverseCellSize));
+    maxRing = std::min(maxRing, std::max(mColumns, mRows));
+
+    std::size_t found = 0;
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        for (int row = centerRow - ring; row <= centerRow + ring; ++row) {
+            if (row < 0 || row >= mRows) continue;
+            bool edgeRow = (row == centerRow - ring || row == centerRow + ring);
+            // Sur les lignes intérieures, seules les deux colonnes du bord appartiennent à l'anneau
+            int step = edgeRow ? 1 : std::max(1, 2 * ring);
+            for (int column = centerColumn - ring; column <= centerColumn + ring; column += step) {
+                if (column < 0 || column >= mColumns) continue;
+                std::size_t cell = static_cast<std::size_t>(row) * mColumns + column;
+                for (uint32_t i = mCellStart[cell]; i < mCellStart[cell + 1]; ++i) {
+                    const Entry& entry = mEntries[i];
+                    float dx = entry.x - center.x;
+                    float dy = entry.y - center.y;
+                    float distanceSquared = dx * dx + dy * dy;
+                    if (distanceSquared > maxRadiusSquared) continue;
+                    if (found == k && distanceSquared >= out[k - 1].distanceSquared) continue;
+
+                    // Insertion triée dans le tableau de résultats
+                    std::size_t position = (found < k) ? found++ : k - 1;
+                    while (position > 0 && out[position - 1].distanceSquared > distanceSquared) {
+                        out[position] = out[position - 1];
+                        --position;
+                    }
+                    out[position] = {entry.id, entry.x, entry.y, distanceSquared};
+                }
+            }
+        }
+
+        // Tout point d'un anneau plus éloigné est à au moins ring * cellSize du centre
+        float ringDistance = ring * mCellSize;
+        if (found == k && out[k - 1].distanceSquared <= ringDistance * ringDistance) break;
+    }
+    return found;
+}
+
+// 🔲 PARCOURS PAR CELLULE
+void SpatialGrid::GetCellRange(float left, float top, float right, float bottom,
+                               int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const {
+    firstColumn = CellColumn(left);
+    firstRow = CellRow(top);
+    lastColumn = CellColumn(right);
+    lastRow = CellRow(bottom);
+}
+
+const SpatialGrid::Entry* SpatialGrid::GetCellBegin(int column, int row) const {
+    return mEntries.data() + mCellStart[static_cast<std::size_t>(row) * mColumns + column];
+}
+
+const SpatialGrid::Entry* SpatialGrid::GetCellEnd(int column, int row) const {
+    return mEntries.data() + mCellStart[static_cast<std::size_t>(row) * mColumns + column + 1];
+}
+
+// 🔐 COORDONNÉES DE CELLULE (bornées à la grille)
+int SpatialGrid::CellColumn(float x) const {
+    int column = static_cast<int>(std::floor(x * mInverseCellSize));
+    return std::clamp(column, 0, mColumns - 1);
+}
+
+int SpatialGrid::CellRow(float y) const {
+    int row = static_cast<int>(std::floor(y * mInverseCellSize));
+    return std::clamp(row, 0, mRows - 1);
+}
+
+} // namespace Core
+} // namespace Ecosystem
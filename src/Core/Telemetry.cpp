@@ -0,0 +1,270 @@
+#include "Core/Telemetry.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+namespace Telemetry {
+
+// 💾 FORMAT DU FICHIER
+static constexpr char kMagic[8] = {'E', 'C', 'O', 'T', 'E', 'L', 'E', 'M'};
+static constexpr uint32_t kVersion = 1;
+static constexpr std::size_t kBlockRows = 4096;   // Lignes par bloc colonnaire
+static constexpr std::size_t kQueueCapacity = 1 << 14;
+
+static std::size_t ColumnSize(ColumnType type) {
+    return type == ColumnType::U64 ? sizeof(uint64_t) : sizeof(uint32_t);
+}
+
+// 🏷 COLONNES - construites une fois à partir de la disposition de Sample
+const std::vector<Column>& GetColumns() {
+    static const std::vector<Column> columns = [] {
+        std::vector<Column> list = {
+            {"tick", ColumnType::U64, offsetof(Sample, tick)},
+            {"herbivores", ColumnType::U32, offsetof(Sample, herbivores)},
+            {"carnivores", ColumnType::U32, offsetof(Sample, carnivores)},
+            {"plants", ColumnType::U32, offsetof(Sample, plants)},
+            {"births", ColumnType::U32, offsetof(Sample, births)},
+            {"deaths", ColumnType::U32, offsetof(Sample, deaths)},
+            {"food", ColumnType::F32, offsetof(Sample, food)},
+        };
+        for (std::size_t i = 0; i < kSpeciesCount; ++i) {
+            list.push_back({std::string("mean_energy_") + SpeciesKey(static_cast<EntityType>(i)), ColumnType::F32,
+                            offsetof(Sample, meanEnergy) + i * sizeof(float)});
+        }
+        for (std::size_t i = 0; i < kLifeStageBuckets; ++i) {
+            list.push_back({"life_stage_" + std::to_string(i), ColumnType::U32,
+                            offsetof(Sample, lifeStage) + i * sizeof(uint32_t)});
+        }
+        for (std::size_t i = 0; i < kPhaseCount; ++i) {
+            list.push_back({std::string("us_") + PhaseName(static_cast<Phase>(i)), ColumnType::F32,
+                            offsetof(Sample, phaseMicroseconds) + i * sizeof(float)});
+        }
+        list.push_back({"us_tick", ColumnType::F32, offsetof(Sample, tickMicroseconds)});
+        return list;
+    }();
+    return columns;
+}
+
+// 📸 CAPTURE
+Sample Capture(const Ecosystem& ecosystem) {
+    Sample sample = {};
+    const Ecosystem::Statistics& stats = ecosystem.GetStatistics();
+    const Ecosystem::Distributions& distributions = ecosystem.GetDistributions();
+    const Ecosystem::TickReport& lastTick = ecosystem.GetLastTick();
+    sample.tick = ecosystem.GetDayCycle();
+    sample.herbivores = static_cast<uint32_t>(stats.totalHerbivores);
+    sample.carnivores = static_cast<uint32_t>(stats.totalCarnivores);
+    sample.plants = static_cast<uint32_t>(stats.totalPlants);
+    sample.births = static_cast<uint32_t>(lastTick.births);
+    sample.deaths = static_cast<uint32_t>(lastTick.deaths);
+    sample.food = static_cast<float>(ecosystem.GetFoodField().GetTotalUnits());
+
+    // Énergie moyenne par espèce et stade de vie (age / maxAge), regroupés
+    // depuis les histogrammes de l'écosystème
+    static_assert(kHistogramBuckets % kLifeStageBuckets == 0, "stades de vie non alignés");
+    constexpr std::size_t kBucketsPerStage = kHistogramBuckets / kLifeStageBuckets;
+    for (std::size_t species = 0; species < kSpeciesCount; ++species) {
+        const Ecosystem::SpeciesDistributions& speciesDistributions = distributions[species];
+        sample.meanEnergy[species] = speciesDistributions.energy.mean;
+        for (std::size_t bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+            sample.lifeStage[bucket / kBucketsPerStage] += speciesDistributions.age.histogram[bucket];
+        }
+    }
+
+    for (std::size_t phase = 0; phase < kPhaseCount; ++phase) {
+        sample.phaseMicroseconds[phase] = lastTick.phaseSeconds[phase] * 1e6f;
+    }
+    sample.tickMicroseconds = lastTick.totalSeconds * 1e6f;
+    return sample;
+}
+
+// 🏗 CONSTRUCTEUR
+Recorder::Recorder(std::size_t historyCapacity)
+    : mHistory(historyCapacity > 0 ? historyCapacity : 1), mHistoryNext(0), mHistorySize(0),
+      mInterval(1), mTicksSinceSample(0), mQueue(kQueueCapacity), mWriting(false)
+{
+}
+
+// 🗑 DESTRUCTEUR - les échantillons en attente sont écrits
+Recorder::~Recorder() {
+    Close();
+}
+
+// 💾 OUVERTURE DU FLUX
+bool Recorder::Open(const std::string& path) {
+    Close();
+    mFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!mFile) {
+        std::cerr << "❌ Impossible de créer le fichier de télémétrie: " << path << std::endl;
+        return false;
+    }
+
+    // En-tête : magie, version, puis (type, longueur du nom, nom) par colonne
+    const std::vector<Column>& columns = GetColumns();
+    uint32_t columnCount = static_cast<uint32_t>(columns.size());
+    mFile.write(kMagic, sizeof(kMagic));
+    mFile.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    mFile.write(reinterpret_cast<const char*>(&columnCount), sizeof(columnCount));
+    for (const Column& column : columns) {
+        uint8_t type = static_cast<uint8_t>(column.type);
+        uint8_t nameLength = static_cast<uint8_t>(column.name.size());
+        mFile.write(reinterpret_cast<const char*>(&type), 1);
+        mFile.write(reinterpret_cast<const char*>(&nameLength), 1);
+        mFile.write(column.name.data(), nameLength);
+    }
+
+    mWriting.store(true, std::memory_order_release);
+    mWriterThread = std::thread(&Recorder::WriterLoop, this);
+    return true;
+}
+
+// 🔒 FERMETURE
+void Recorder::Close() {
+    if (!mWriterThread.joinable()) return;
+    mWriting.store(false, std::memory_order_release);
+    mWriterThread.join();
+    mFile.close();
+}
+
+// 📸 ENREGISTREMENT
+void Recorder::Record(const Ecosystem& ecosystem) {
+    if (++mTicksSinceSample < static_cast<uint64_t>(mInterval)) return;
+    mTicksSinceSample = 0;
+    Record(Capture(ecosystem));
+}
+
+void Recorder::Record(const Sample& sample) {
+    mHistory[mHistoryNext] = sample;
+    mHistoryNext = (mHistoryNext + 1) % mHistory.size();
+    if (mHistorySize < mHistory.size()) mHistorySize++;
+
+    // Aucun échantillon n'est perdu : si l'écrivain prend du retard, on l'attend
+    if (mWriterThread.joinable()) {
+        while (!mQueue.TryPush(sample)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+const Sample& Recorder::GetHistory(std::size_t age) const {
+    std::size_t capacity = mHistory.size();
+    return mHistory[(mHistoryNext + capacity - 1 - age % capacity) % capacity];
+}
+
+// 🔁 THREAD D'ÉCRITURE - regroupe les échantillons en blocs colonnaires
+void Recorder::WriterLoop() {
+    std::vector<Sample> block;
+    block.reserve(kBlockRows);
+    Sample sample;
+    while (true) {
+        // Lu avant de vider la file : si l'écriture est arrêtée, tout a déjà été déposé
+        bool writing = mWriting.load(std::memory_order_acquire);
+        while (block.size() < kBlockRows && mQueue.TryPop(sample)) {
+            block.push_back(sample);
+        }
+        if (block.size() == kBlockRows) {
+            WriteBlock(block);
+            block.clear();
+            continue;
+        }
+        if (!writing) {
+            if (!block.empty()) WriteBlock(block);
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    mFile.flush();
+}
+
+// 📦 UN BLOC : nombre de lignes puis chaque colonne contiguë
+void Recorder::WriteBlock(const std::vector<Sample>& block) {
+    uint32_t rowCount = static_cast<uint32_t>(block.size());
+    mFile.write(reinterpret_cast<const char*>(&rowCount), sizeof(rowCount));
+
+    std::vector<char> column;
+    for (const Column& description : GetColumns()) {
+        std::size_t size = ColumnSize(description.type);
+        column.resize(block.size() * size);
+        for (std::size_t row = 0; row < block.size(); ++row) {
+            std::memcpy(&column[row * size], reinterpret_cast<const char*>(&block[row]) + description.offset, size);
+        }
+        mFile.write(column.data(), static_cast<std::streamsize>(column.size()));
+    }
+}
+
+// 📄 EXPORT CSV
+bool ExportCsv(const std::string& binaryPath, const std::string& csvPath) {
+    std::ifstream input(binaryPath, std::ios::binary);
+    if (!input) {
+        std::cerr << "❌ Fichier de télémétrie introuvable: " << binaryPath << std::endl;
+        return false;
+    }
+
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    uint32_t columnCount = 0;
+    input.read(magic, sizeof(magic));
+    input.read(reinterpret_cast<char*>(&version), sizeof(version));
+    input.read(reinterpret_cast<char*>(&columnCount), sizeof(columnCount));
+    if (!input || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || version != kVersion) {
+        std::cerr << "❌ Fichier de télémétrie invalide: " << binaryPath << std::endl;
+        return false;
+    }
+
+    // Colonnes décrites par le fichier lui-même (pas par cette version du programme)
+    std::vector<ColumnType> types(columnCount);
+    std::ofstream output(csvPath);
+    if (!output) {
+        std::cerr << "❌ Impossible de créer le CSV: " << csvPath << std::endl;
+        return false;
+    }
+    for (uint32_t c = 0; c < columnCount; ++c) {
+        uint8_t type = 0;
+        uint8_t nameLength = 0;
+        input.read(reinterpret_cast<char*>(&type), 1);
+        input.read(reinterpret_cast<char*>(&nameLength), 1);
+        std::string name(nameLength, '\0');
+        input.read(&name[0], nameLength);
+        if (!input || type > static_cast<uint8_t>(ColumnType::F32)) {
+            std::cerr << "❌ En-tête de télémétrie corrompu: " << binaryPath << std::endl;
+            return false;
+        }
+        types[c] = static_cast<ColumnType>(type);
+        output << (c ? "," : "") << name;
+    }
+    output << '\n' << std::setprecision(7);
+
+    std::vector<std::vector<char>> columns(columnCount);
+    uint32_t rowCount = 0;
+    while (input.read(reinterpret_cast<char*>(&rowCount), sizeof(rowCount))) {
+        for (uint32_t c = 0; c < columnCount; ++c) {
+            columns[c].resize(rowCount * ColumnSize(types[c]));
+            input.read(columns[c].data(), static_cast<std::streamsize>(columns[c].size()));
+        }
+        if (!input) {
+            std::cerr << "❌ Bloc de télémétrie tronqué: " << binaryPath << std::endl;
+            return false;
+        }
+        for (uint32_t row = 0; row < rowCount; ++row) {
+            for (uint32_t c = 0; c < columnCount; ++c) {
+                const char* value = &columns[c][row * ColumnSize(types[c])];
+                if (c) output << ',';
+                switch (types[c]) {
+                    case ColumnType::U32: { uint32_t v; std::memcpy(&v, value, sizeof(v)); output << v; break; }
+                    case ColumnType::U64: { uint64_t v; std::memcpy(&v, value, sizeof(v)); output << v; break; }
+                    case ColumnType::F32: { float v; std::memcpy(&v, value, sizeof(v)); output << v; break; }
+                }
+            }
+            output << '\n';
+        }
+    }
+    return static_cast<bool>(output);
+}
+
+} // namespace Telemetry
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,131 @@
+#include "Core/ThreadPool.hpp"
+#include "Core/Profiler.hpp"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : mPendingTasks(0), mGeneration(0), mStopping(false)
+{
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        mQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+    // Le travailleur 0 est le thread appelant
+    for (std::size_t worker = 1; worker < threadCount; ++worker) {
+        mThreads.emplace_back(&ThreadPool::WorkerLoop, this, worker);
+    }
+}
+
+// 🗑 DESTRUCTEUR
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping = true;
+    }
+    mWakeCondition.notify_all();
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+}
+
+// ⚙️ BOUCLE PARALLÈLE
+void ThreadPool::ParallelFor(std::size_t count, std::size_t grain, const RangeFunction& function) {
+    if (count == 0) return;
+    grain = std::max<std::size_t>(grain, 1);
+
+    // Un seul travailleur ou un seul bloc : exécution directe
+    if (mQueues.size() == 1 || count <= grain) {
+        function(0, count, 0);
+        return;
+    }
+
+    // Distribution des blocs en tourniquet sur les files des travailleurs
+    std::size_t taskCount = (count + grain - 1) / grain;
+    mPendingTasks.store(taskCount, std::memory_order_relaxed);
+    for (std::size_t task = 0; task < taskCount; ++task) {
+        WorkerQueue& queue = *mQueues[task % mQueues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back({task * grain, std::min(count, (task + 1) * grain), &function});
+    }
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        ++mGeneration;
+    }
+    mWakeCondition.notify_all();
+
+    // Le thread appelant travaille jusqu'à épuisement des blocs
+    while (mPendingTasks.load(std::memory_order_acquire) > 0) {
+        if (!RunOneTask(0)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// 🔁 BOUCLE D'UN TRAVAILLEUR
+void ThreadPool::WorkerLoop(std::size_t worker) {
+    ECOSYSTEM_PROFILE_THREAD("worker");
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mWakeMutex);
+            mWakeCondition.wait(lock, [&] { return mStopping || mGeneration != seenGeneration; });
+            if (mStopping) return;
+            seenGeneration = mGeneration;
+        }
+        while (RunOneTask(worker)) {
+        }
+    }
+}
+
+// ▶️ EXÉCUTION D'UNE TÂCHE (locale, sinon volée)
+bool ThreadPool::RunOneTask(std::size_t worker) {
+    Task task;
+    if (!PopTask(worker, task) && !StealTask(worker, task)) {
+        return false;
+    }
+    {
+        ECOSYSTEM_PROFILE_ZONE("ParallelFor block");
+        (*task.function)(task.begin, task.end, worker);
+    }
+    mPendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+// 📤 DÉPILEMENT LOCAL (par l'arrière)
+bool ThreadPool::PopTask(std::size_t worker, Task& task) {
+    WorkerQueue& queue = *mQueues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head == queue.tasks.size()) return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    if (queue.head == queue.tasks.size()) {
+        // File vide : on la réinitialise en conservant sa capacité
+        queue.tasks.clear();
+        queue.head = 0;
+    }
+    return true;
+}
+
+// 🦝 VOL DE TÂCHE (par l'avant des autres files)
+bool ThreadPool::StealTask(std::size_t thief, Task& task) {
+    for (std::size_t offset = 1; offset < mQueues.size(); ++offset) {
+        WorkerQueue& queue = *mQueues[(thief + offset) % mQueues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.head == queue.tasks.size()) continue;
+        task = queue.tasks[queue.head++];
+        if (queue.head == queue.tasks.size()) {
+            queue.tasks.clear();
+            queue.head = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,83 @@
+#include "Core/TimingWheel.hpp"
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+TimingWheel::TimingWheel(uint64_t now)
+    : mNow(now), mSize(0)
+{
+}
+
+// ⚙️ VIDAGE - les cases gardent leur capacité
+void TimingWheel::Reset(uint64_t now) {
+    for (auto& slot : mSlots) {
+        slot.clear();
+    }
+    mOverflow.clear();
+    mNow = now;
+    mSize = 0;
+}
+
+// 📅 PLANIFICATION
+void TimingWheel::Schedule(const TimedEvent& event) {
+    TimedEvent placed = event;
+    if (placed.tick <= mNow) {
+        placed.tick = mNow + 1;
+    }
+    Place(placed);
+    ++mSize;
+}
+
+// Niveau du premier octet (en partant du haut) où le tick diffère de mNow
+void TimingWheel::Place(const TimedEvent& event) {
+    uint64_t differing = event.tick ^ mNow;
+    for (std::size_t level = 0; level < kLevels; ++level) {
+        if ((differing >> (kSlotBits * (level + 1))) == 0) {
+            std::size_t slot = static_cast<std::size_t>(event.tick >> (kSlotBits * level)) & (kSlots - 1);
+            mSlots[level * kSlots + slot].push_back(event);
+            return;
+        }
+    }
+    mOverflow.push_back(event);
+}
+
+// 🔽 Redescente d'une case : ses événements sont rangés à nouveau par rapport à mNow
+void TimingWheel::Cascade(std::vector<TimedEvent>& slot) {
+    mCascade.swap(slot);
+    for (const TimedEvent& event : mCascade) {
+        Place(event);
+    }
+    mCascade.clear();
+}
+
+// ⏩ AVANCE
+void TimingWheel::Advance(uint64_t now, std::vector<TimedEvent>& due) {
+    while (mNow < now) {
+        ++mNow;
+        if (mSize == 0) {
+            mNow = now;  // Roue vide : rien à redescendre
+            break;
+        }
+
+        // Du plus haut niveau au plus bas : une case atteinte redescend
+        // entièrement, éventuellement jusqu'au niveau 0 le même tick
+        if ((mNow & ((uint64_t(1) << (kSlotBits * kLevels)) - 1)) == 0) {
+            Cascade(mOverflow);
+        }
+        for (std::size_t level = kLevels - 1; level > 0; --level) {
+            if ((mNow & ((uint64_t(1) << (kSlotBits * level)) - 1)) == 0) {
+                std::size_t slot = static_cast<std::size_t>(mNow >> (kSlotBits * level)) & (kSlots - 1);
+                Cascade(mSlots[level * kSlots + slot]);
+            }
+        }
+
+        std::vector<TimedEvent>& current = mSlots[static_cast<std::size_t>(mNow) & (kSlots - 1)];
+        due.insert(due.end(), current.begin(), current.end());
+        mSize -= current.size();
+        current.clear();
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,348 @@
+#include "Engine/GameEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace Ecosystem {
+namespace Engine {
+
+// 🏗 CONSTRUCTEUR
+GameEngine::GameEngine(const std::string& title, float width, float height,
+                       float worldWidth, float worldHeight, int maxEntities, uint32_t seed)
+    : mWindow(title, width, height),
+      mEcosystem(worldWidth, worldHeight, maxEntities, seed),
+      mSeed(seed),
+      mCamera(width, height, worldWidth, worldHeight),
+      mInitialPopulation({20, 5, 30}),
+      mIsRunning(false), 
+      mIsPaused(false),
+      mTimeScale(1.0f),
+      mAccumulatedTime(0.0f),
+      mFixedTimeStep(1.0f / 60.0f),
+      mStepBudget(0.012f),
+      mTurboMode(false),
+      mTurboPresentInterval(30),
+      mFramesSinceRender(0),
+      mSnapshotPath("ecosystem.snap"),
+      mShowHud(false),
+      mFrameMilliseconds(120, 0.0f),
+      mFrameNext(0),
+      mTracePath("ecosystem_trace.json") {}
+
+// ⚙️ INITIALISATION
+bool GameEngine::Initialize() {
+    if (!mWindow.Initialize()) {
+        return false;
+    }
+    mRenderer = std::make_unique<Graphics::Renderer>(mWindow.GetRenderer());
+    ECOSYSTEM_PROFILE_THREAD("main");
+    mEcosystem.Initialize(mInitialPopulation[0], mInitialPopulation[1], mInitialPopulation[2]);
+    mIsRunning = true;
+    mLastUpdateTime = std::chrono::high_resolution_clock::now();
+    std::cout << "✅ Moteur de jeu initialisé" << std::endl;
+    return true;
+}
+
+// 🎮 BOUCLE PRINCIPALE
+void GameEngine::Run() {
+    std::cout << "🎯 Démarrage de la boucle de jeu..." << std::endl;
+    while (mIsRunning) {
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float> elapsed = currentTime - mLastUpdateTime;
+        mLastUpdateTime = currentTime;
+        
+        float deltaTime = elapsed.count();
+        
+        {
+            ECOSYSTEM_PROFILE_ZONE("GameEngine::Frame");
+            HandleEvents();
+
+            if (!mIsPaused) {
+                ECOSYSTEM_PROFILE_ZONE("GameEngine::StepSimulation");
+                StepSimulation(deltaTime);
+            }
+
+            // En turbo, seule une image sur N est rendue
+            if (!mTurboMode || ++mFramesSinceRender >= mTurboPresentInterval) {
+                Render();
+                mFramesSinceRender = 0;
+            }
+        }
+
+        // Zones relevées entre deux images : aucun travailleur n'est actif
+        if (Core::Profiler::IsCapturing()) {
+            Core::Profiler::Collect(mTraceEvents);
+        }
+
+        // Durée de travail de l'image (hors attente), pour le HUD
+        std::chrono::duration<float> frameTime = std::chrono::high_resolution_clock::now() - currentTime;
+        RecordFrameTime(frameTime.count() * 1000.0f);
+
+        // Limitation à ~60 FPS (sauf en turbo)
+        if (!mTurboMode) {
+            float remaining = 1.0f / 60.0f - frameTime.count();
+            if (remaining > 0.0f) {
+                SDL_Delay(static_cast<Uint32>(remaining * 1000.0f));
+            }
+        }
+    }
+}
+
+// 🔁 SIMULATION À PAS FIXE
+// Le temps réel écoulé (accéléré par mTimeScale) est découpé en ticks de
+// durée fixe : accélérer donne plus de ticks par seconde, pas des ticks
+// plus grossiers. Le nombre de ticks par image est limité par mStepBudget.
+int GameEngine::StepSimulation(float frameTime) {
+    auto budgetEnd = std::chrono::high_resolution_clock::now() +
+                     std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+                         std::chrono::duration<float>(mStepBudget));
+
+    if (!mTurboMode) {
+        mAccumulatedTime += frameTime * mTimeScale;
+    }
+
+    int steps = 0;
+    while (mTurboMode || mAccumulatedTime >= mFixedTimeStep) {
+        Update(mFixedTimeStep);
+        ++steps;
+        if (!mTurboMode) {
+            mAccumulatedTime -= mFixedTimeStep;
+        }
+        if (std::chrono::high_resolution_clock::now() >= budgetEnd) {
+            break;
+        }
+    }
+
+    // Budget dépassé : le retard est abandonné plutôt qu'accumulé sans fin
+    mAccumulatedTime = std::min(mAccumulatedTime, mFixedTimeStep);
+    return steps;
+}
+
+// 📖 REPRISE DEPUIS UN INSTANTANÉ - F5/F9 utiliseront ensuite le même fichier
+bool GameEngine::LoadSnapshot(const std::string& path) {
+    mSnapshotPath = path;
+    if (!mReplay.IsOpen()) {
+        mStartSnapshot = path;
+    }
+    if (!ApplyCommand(Core::Replay::Command::LOAD_SNAPSHOT, 0, path)) {
+        return false;
+    }
+    mCamera.SetWorld(mEcosystem.GetWorldWidth(), mEcosystem.GetWorldHeight());
+    if (mRenderer) {
+        mRenderer->InvalidateScene();
+    }
+    mAccumulatedTime = 0.0f;
+    return true;
+}
+
+// 🎬 ENREGISTREMENT - le journal suffit à rejouer la session sans fenêtre
+bool GameEngine::StartRecording(const std::string& path) {
+    Core::Replay::RunConfig config;
+    config.seed = mSeed;
+    config.deltaTime = mFixedTimeStep;
+    config.worldWidth = mEcosystem.GetWorldWidth();
+    config.worldHeight = mEcosystem.GetWorldHeight();
+    config.maxEntities = mEcosystem.GetMaxEntities();
+    for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+        config.population[species] = mInitialPopulation[species];
+    }
+    config.loadPath = mStartSnapshot;
+    return mReplay.Open(path, config);
+}
+
+// ⌨️ COMMANDE DE SIMULATION - enregistrée puis appliquée comme au rejeu
+bool GameEngine::ApplyCommand(Core::Replay::Command command, uint32_t amount, const std::string& path) {
+    mReplay.RecordInput(command, amount, path);
+    Core::Replay::RunConfig config;
+    for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+        config.population[species] = mInitialPopulation[species];
+    }
+    return Core::Replay::Apply(mEcosystem, config, {mReplay.GetTick(), command, amount, path});
+}
+
+// 🧹 FERMETURE
+void GameEngine::Shutdown() {
+    mIsRunning = false;
+    mReplay.Close();
+    if (Core::Profiler::IsCapturing()) {
+        ToggleTrace();  // Une trace en cours n'est pas perdue
+    }
+    std::cout << "🔄 Moteur de jeu arrêté" << std::endl;
+}
+
+// 🎮 GESTION DES ÉVÉNEMENTS
+void GameEngine::HandleEvents() {
+    SDL_Event event;
+    while (SDL_PollEvent(&event)) {
+        switch (event.type) {
+            case SDL_EVENT_QUIT:
+                mIsRunning = false;
+                break;
+                
+            case SDL_EVENT_KEY_DOWN:
+                HandleInput(event.key.key);
+                break;
+
+            // 🎥 Caméra : molette pour zoomer sous le curseur, glisser pour déplacer
+            case SDL_EVENT_MOUSE_WHEEL:
+                mCamera.ZoomAt(std::pow(1.15f, event.wheel.y), event.wheel.mouse_x, event.wheel.mouse_y);
+                break;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                if (event.motion.state & SDL_BUTTON_LMASK) {
+                    mCamera.Pan(event.motion.xrel, event.motion.yrel);
+                }
+                break;
+        }
+    }
+}
+
+// ⌨️ GESTION DES TOUCHES
+void GameEngine::HandleInput(SDL_Keycode key) {
+    switch (key) {
+        case SDLK_ESCAPE:
+            mIsRunning = false;
+            break;
+            
+        case SDLK_SPACE:
+            mIsPaused = !mIsPaused;
+            std::cout << (mIsPaused ? "⏸️ Simulation en pause" : "▶️ Simulation reprise") << std::endl;
+            break;
+            
+        case SDLK_r:
+            ApplyCommand(Core::Replay::Command::RESET);
+            mRenderer->InvalidateScene();
+            std::cout << "🔄 Simulation réinitialisée" << std::endl;
+            break;
+            
+        case SDLK_f:
+            ApplyCommand(Core::Replay::Command::SPAWN_FOOD, 10);
+            std::cout << "🍎 Nourriture ajoutée" << std::endl;
+            break;
+            
+        case SDLK_UP:
+            mTimeScale *= 1.5f;
+            std::cout << "⏩ Vitesse: " << mTimeScale << "x" << std::endl;
+            break;
+            
+        case SDLK_DOWN:
+            mTimeScale /= 1.5f;
+            std::cout << "⏪ Vitesse: " << mTimeScale << "x" << std::endl;
+            break;
+            
+        case SDLK_t:
+            mTurboMode = !mTurboMode;
+            mAccumulatedTime = 0.0f;
+            mFramesSinceRender = 0;
+            std::cout << (mTurboMode ? "🚀 Mode turbo activé" : "🐢 Mode turbo désactivé") << std::endl;
+            break;
+
+        case SDLK_F5:
+            mEcosystem.SaveSnapshot(mSnapshotPath);
+            break;
+
+        case SDLK_F9:
+            LoadSnapshot(mSnapshotPath);
+            break;
+
+        case SDLK_h:
+            mShowHud = !mShowHud;
+            break;
+
+        case SDLK_EQUALS:
+            mCamera.ZoomAt(1.5f, mCamera.GetViewportWidth() / 2.0f, mCamera.GetViewportHeight() / 2.0f);
+            break;
+
+        case SDLK_MINUS:
+            mCamera.ZoomAt(1.0f / 1.5f, mCamera.GetViewportWidth() / 2.0f, mCamera.GetViewportHeight() / 2.0f);
+            break;
+
+        case SDLK_HOME:
+            mCamera.Fit();
+            break;
+
+        case SDLK_F12:
+            ToggleTrace();
+            break;
+    }
+}
+
+// 🔄 MISE À JOUR
+void GameEngine::Update(float deltaTime) {
+    mEcosystem.Update(deltaTime);
+    mReplay.RecordTick(mEcosystem);
+    mTelemetry.Record(mEcosystem);
+}
+
+// 🎨 RENDU
+void GameEngine::Render() {
+    ECOSYSTEM_PROFILE_ZONE("GameEngine::Render");
+    mWindow.Clear();
+    
+    // Rendu de l'écosystème
+    mRenderer->RenderEcosystem(mEcosystem, mCamera);
+    
+    RenderUI();
+    
+    ECOSYSTEM_PROFILE_ZONE("Window::Present");
+    mWindow.Present();
+}
+
+// 📊 INTERFACE UTILISATEUR
+void GameEngine::RenderUI() {
+    ECOSYSTEM_PROFILE_ZONE("GameEngine::RenderUI");
+    mRenderer->RenderStatistics(mEcosystem.GetStatistics());
+    if (!mShowHud) return;
+
+    // Images du plus ancien au plus récent
+    std::size_t frameCount = mFrameMilliseconds.size();
+    mHud.frameMilliseconds.resize(frameCount);
+    for (std::size_t i = 0; i < frameCount; ++i) {
+        mHud.frameMilliseconds[i] = mFrameMilliseconds[(mFrameNext + i) % frameCount];
+    }
+
+    // Phases moyennées sur la dernière seconde de ticks (historique de télémétrie)
+    std::size_t samples = std::min<std::size_t>(mTelemetry.GetHistorySize(), 60);
+    mHud.phaseMicroseconds.fill(0.0f);
+    mHud.tickMicroseconds = 0.0f;
+    for (std::size_t age = 0; age < samples; ++age) {
+        const Core::Telemetry::Sample& sample = mTelemetry.GetHistory(age);
+        for (std::size_t phase = 0; phase < Core::kPhaseCount; ++phase) {
+            mHud.phaseMicroseconds[phase] += sample.phaseMicroseconds[phase] / samples;
+        }
+        mHud.tickMicroseconds += sample.tickMicroseconds / samples;
+    }
+    mHud.capturing = Core::Profiler::IsCapturing();
+    mRenderer->RenderProfilerHud(mHud);
+}
+
+void GameEngine::RecordFrameTime(float milliseconds) {
+    mFrameMilliseconds[mFrameNext] = milliseconds;
+    mFrameNext = (mFrameNext + 1) % mFrameMilliseconds.size();
+}
+
+// ⏱ TRACE CHROME - premier appui : capture, second appui : écriture
+void GameEngine::ToggleTrace() {
+#if ECOSYSTEM_PROFILING
+    if (!Core::Profiler::IsCapturing()) {
+        mTraceEvents.clear();
+        Core::Profiler::Collect(mTraceEvents);  // Vide les restes d'une capture précédente
+        mTraceEvents.clear();
+        Core::Profiler::SetCapturing(true);
+        std::cout << "⏺️ Capture de trace démarrée" << std::endl;
+        return;
+    }
+    Core::Profiler::SetCapturing(false);
+    Core::Profiler::Collect(mTraceEvents);
+    if (Core::Profiler::WriteChromeTrace(mTracePath, mTraceEvents)) {
+        std::cout << "💾 Trace écrite: " << mTracePath << " (" << mTraceEvents.size() << " zones)" << std::endl;
+    }
+    mTraceEvents.clear();
+#else
+    std::cout << "⚠️ Profilage retiré de ce build (ECOSYSTEM_PROFILING=0)" << std::endl;
+#endif
+}
+
+} // namespace Engine
+} // namespace Ecosystem
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "Graphics/Camera.hpp"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+Camera::Camera(float viewportWidth, float viewportHeight, float worldWidth, float worldHeight)
+    : mCenterX(0.0f), mCenterY(0.0f), mZoom(1.0f),
+      mViewportWidth(std::max(viewportWidth, 1.0f)), mViewportHeight(std::max(viewportHeight, 1.0f)),
+      mWorldWidth(std::max(worldWidth, 1.0f)), mWorldHeight(std::max(worldHeight, 1.0f))
+{
+    mZoom = std::min(1.0f, GetMinZoom());
+    mCenterX = mWorldWidth / 2.0f;
+    mCenterY = mWorldHeight / 2.0f;
+    Clamp();
+}
+
+// ⚙️ CONFIGURATION
+void Camera::SetWorld(float width, float height) {
+    mWorldWidth = std::max(width, 1.0f);
+    mWorldHeight = std::max(height, 1.0f);
+    Clamp();
+}
+
+void Camera::SetViewport(float width, float height) {
+    mViewportWidth = std::max(width, 1.0f);
+    mViewportHeight = std::max(height, 1.0f);
+    Clamp();
+}
+
+void Camera::Fit() {
+    mZoom = GetMinZoom();
+    mCenterX = mWorldWidth / 2.0f;
+    mCenterY = mWorldHeight / 2.0f;
+}
+
+// 🔍 Zoom auquel le monde entier tient dans la fenêtre
+float Camera::GetMinZoom() const {
+    return std::min(mViewportWidth / mWorldWidth, mViewportHeight / mWorldHeight);
+}
+
+// 🕹 DÉPLACEMENTS
+void Camera::Pan(float screenDeltaX, float screenDeltaY) {
+    mCenterX -= screenDeltaX / mZoom;
+    mCenterY -= screenDeltaY / mZoom;
+    Clamp();
+}
+
+void Camera::ZoomAt(float factor, float screenX, float screenY) {
+    Core::Vector2D anchor = ScreenToWorld(Core::Vector2D(screenX, screenY));
+    mZoom = std::clamp(mZoom * factor, GetMinZoom(), std::max(kMaxZoom, GetMinZoom()));
+    // Le point du monde sous le curseur reste sous le curseur
+    mCenterX = anchor.x - (screenX - mViewportWidth / 2.0f) / mZoom;
+    mCenterY = anchor.y - (screenY - mViewportHeight / 2.0f) / mZoom;
+    Clamp();
+}
+
+// 📐 CONVERSIONS
+Core::Vector2D Camera::WorldToScreen(Core::Vector2D world) const {
+    return Core::Vector2D((world.x - GetLeft()) * mZoom, (world.y - GetTop()) * mZoom);
+}
+
+Core::Vector2D Camera::ScreenToWorld(Core::Vector2D screen) const {
+    return Core::Vector2D(GetLeft() + screen.x / mZoom, GetTop() + screen.y / mZoom);
+}
+
+// 📏 Le centre reste dans le monde ; un axe plus petit que la fenêtre est centré
+void Camera::Clamp() {
+    mZoom = std::clamp(mZoom, GetMinZoom(), std::max(kMaxZoom, GetMinZoom()));
+    float halfWidth = mViewportWidth / (2.0f * mZoom);
+    float halfHeight = mViewportHeight / (2.0f * mZoom);
+    mCenterX = halfWidth * 2.0f >= mWorldWidth ? mWorldWidth / 2.0f
+                                               : std::clamp(mCenterX, halfWidth, mWorldWidth - halfWidth);
+    mCenterY = halfHeight * 2.0f >= mWorldHeight ? mWorldHeight / 2.0f
+                                                 : std::clamp(mCenterY, halfHeight, mWorldHeight - halfHeight);
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
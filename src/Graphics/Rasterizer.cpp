@@ -0,0 +1,147 @@
+#include "Graphics/Rasterizer.hpp"
+#include "Core/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+Rasterizer::Rasterizer(int width, int height, std::size_t threadCount)
+    : mWidth(std::max(width, 1)), mHeight(std::max(height, 1)),
+      mTileColumns(0), mTileRows(0), mPool(threadCount)
+{
+    mTileColumns = (mWidth + kTileSize - 1) / kTileSize;
+    mTileRows = (mHeight + kTileSize - 1) / kTileSize;
+    mPixels.resize(static_cast<std::size_t>(mWidth) * mHeight * 3);
+}
+
+// 🎨 RENDU
+void Rasterizer::Render(const RenderBatch& batch, const Core::Color& background) {
+    std::size_t rectCount = batch.GetRectCount();
+    std::size_t chunkCount = std::max<std::size_t>(1, (rectCount + kRectsPerChunk - 1) / kRectsPerChunk);
+    std::size_t tileCount = static_cast<std::size_t>(mTileColumns) * mTileRows;
+    mRects.resize(rectCount);
+    if (mBins.size() < chunkCount * tileCount) {
+        mBins.resize(chunkCount * tileCount);
+    }
+
+    {
+        ECOSYSTEM_PROFILE_ZONE("Rasterizer::Bin");
+        mPool.ParallelFor(chunkCount, 1, [this, &batch](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t chunk = begin; chunk < end; ++chunk) {
+                Bin(chunk, batch);
+            }
+        });
+    }
+
+    ECOSYSTEM_PROFILE_ZONE("Rasterizer::Fill");
+    mPool.ParallelFor(tileCount, 1, [this, chunkCount, &background](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t tile = begin; tile < end; ++tile) {
+            FillTile(static_cast<int>(tile), chunkCount, background);
+        }
+    });
+}
+
+// 🗂 RÉPARTITION d'un bloc de rectangles : conversion en pixels entiers,
+// puis ajout à chaque tuile touchée
+void Rasterizer::Bin(std::size_t chunk, const RenderBatch& batch) {
+    std::size_t tileCount = static_cast<std::size_t>(mTileColumns) * mTileRows;
+    std::vector<uint32_t>* bins = &mBins[chunk * tileCount];
+    for (std::size_t tile = 0; tile < tileCount; ++tile) {
+        bins[tile].clear();
+    }
+
+    // Premier pixel dont le centre est au-delà de la coordonnée, borné avant conversion
+    auto pixel = [](float coordinate, int limit) {
+        return static_cast<int>(std::clamp(std::ceil(coordinate - 0.5f), 0.0f, static_cast<float>(limit)));
+    };
+    const std::vector<Vertex>& vertices = batch.GetVertices();
+    std::size_t first = chunk * kRectsPerChunk;
+    std::size_t last = std::min(first + kRectsPerChunk, mRects.size());
+    for (std::size_t i = first; i < last; ++i) {
+        // Sommets 0 et 2 : coins opposés (voir RenderBatch::AddRect)
+        const Vertex& corner = vertices[i * 4];
+        const Vertex& opposite = vertices[i * 4 + 2];
+        PixelRect& rect = mRects[i];
+        rect.left = pixel(std::min(corner.x, opposite.x), mWidth);
+        rect.right = pixel(std::max(corner.x, opposite.x), mWidth);
+        rect.top = pixel(std::min(corner.y, opposite.y), mHeight);
+        rect.bottom = pixel(std::max(corner.y, opposite.y), mHeight);
+        rect.r = static_cast<uint8_t>(corner.r * 255.0f + 0.5f);
+        rect.g = static_cast<uint8_t>(corner.g * 255.0f + 0.5f);
+        rect.b = static_cast<uint8_t>(corner.b * 255.0f + 0.5f);
+        rect.a = static_cast<uint8_t>(corner.a * 255.0f + 0.5f);
+        if (rect.left >= rect.right || rect.top >= rect.bottom || rect.a == 0) continue;
+        int firstColumn = rect.left / kTileSize;
+        int lastColumn = (rect.right - 1) / kTileSize;
+        int firstRow = rect.top / kTileSize;
+        int lastRow = (rect.bottom - 1) / kTileSize;
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                bins[row * mTileColumns + column].push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+}
+
+// 🧱 REMPLISSAGE D'UNE TUILE - fond, puis les rectangles des blocs dans l'ordre
+void Rasterizer::FillTile(int tile, std::size_t chunkCount, const Core::Color& background) {
+    int tileLeft = (tile % mTileColumns) * kTileSize;
+    int tileTop = (tile / mTileColumns) * kTileSize;
+    int tileRight = std::min(tileLeft + kTileSize, mWidth);
+    int tileBottom = std::min(tileTop + kTileSize, mHeight);
+    std::size_t stride = static_cast<std::size_t>(mWidth) * 3;
+
+    FillOpaque(tileLeft, tileTop, tileRight, tileBottom, background.r, background.g, background.b);
+
+    std::size_t tileCount = static_cast<std::size_t>(mTileColumns) * mTileRows;
+    for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        for (uint32_t index : mBins[chunk * tileCount + tile]) {
+            const PixelRect& rect = mRects[index];
+            int left = std::max(rect.left, tileLeft);
+            int right = std::min(rect.right, tileRight);
+            int top = std::max(rect.top, tileTop);
+            int bottom = std::min(rect.bottom, tileBottom);
+            if (rect.a == 255) {
+                FillOpaque(left, top, right, bottom, rect.r, rect.g, rect.b);
+                continue;
+            }
+            // Mélange alpha : dst = src·a + dst·(1 - a), arrondi au plus proche
+            unsigned alpha = rect.a;
+            unsigned inverse = 255 - alpha;
+            auto blend = [alpha, inverse](uint8_t source, uint8_t destination) {
+                unsigned value = source * alpha + destination * inverse + 128;
+                return static_cast<uint8_t>((value + (value >> 8)) >> 8);
+            };
+            for (int y = top; y < bottom; ++y) {
+                uint8_t* pixel = &mPixels[y * stride + left * 3];
+                for (int x = left; x < right; ++x, pixel += 3) {
+                    pixel[0] = blend(rect.r, pixel[0]);
+                    pixel[1] = blend(rect.g, pixel[1]);
+                    pixel[2] = blend(rect.b, pixel[2]);
+                }
+            }
+        }
+    }
+}
+
+// ⬛ RECTANGLE OPAQUE - première ligne pixel par pixel, les suivantes par copie
+void Rasterizer::FillOpaque(int left, int top, int right, int bottom, uint8_t r, uint8_t g, uint8_t b) {
+    if (left >= right || top >= bottom) return;
+    std::size_t stride = static_cast<std::size_t>(mWidth) * 3;
+    std::size_t rowBytes = static_cast<std::size_t>(right - left) * 3;
+    uint8_t* first = &mPixels[top * stride + left * 3];
+    for (uint8_t* pixel = first; pixel < first + rowBytes; pixel += 3) {
+        pixel[0] = r;
+        pixel[1] = g;
+        pixel[2] = b;
+    }
+    for (int y = top + 1; y < bottom; ++y) {
+        std::memcpy(first + (y - top) * stride, first, rowBytes);
+    }
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,188 @@
+#include "Graphics/RenderBatch.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🧹 VIDAGE (la capacité est conservée)
+void RenderBatch::Clear() {
+    mVertices.clear();
+    mIndices.clear();
+}
+
+// ➕ AJOUT D'UN RECTANGLE PLEIN (4 sommets, 2 triangles)
+void RenderBatch::AddRect(float x, float y, float width, float height, const Core::Color& color) {
+    const float scale = 1.0f / 255.0f;
+    float r = color.r * scale;
+    float g = color.g * scale;
+    float b = color.b * scale;
+    float a = color.a * scale;
+
+    int base = static_cast<int>(mVertices.size());
+    mVertices.push_back({x, y, r, g, b, a, 0.0f, 0.0f});
+    mVertices.push_back({x + width, y, r, g, b, a, 0.0f, 0.0f});
+    mVertices.push_back({x + width, y + height, r, g, b, a, 0.0f, 0.0f});
+    mVertices.push_back({x, y + height, r, g, b, a, 0.0f, 0.0f});
+
+    mIndices.push_back(base);
+    mIndices.push_back(base + 1);
+    mIndices.push_back(base + 2);
+    mIndices.push_back(base);
+    mIndices.push_back(base + 2);
+    mIndices.push_back(base + 3);
+}
+
+// 🐾 UNE ENTITÉ, vue depuis (left, top) avec le zoom donné
+template <typename Species>
+static void AddEntity(RenderBatch& batch, const Core::EntityStore& entities, std::size_t i,
+                      float left, float top, float zoom) {
+    static const Core::Color energyBarColor(0, 255, 0, 255);
+    float size = entities.size[i];
+    float x = (entities.positionX[i] - size / 2.0f - left) * zoom;
+    float y = (entities.positionY[i] - size / 2.0f - top) * zoom;
+    float energyRatio = entities.GetEnergy(i) / entities.maxEnergy[i];
+    batch.AddRect(x, y, size * zoom, size * zoom, Core::Entity::CalculateColor(entities.color[i], energyRatio));
+
+    // 🔵 Indicateur d'énergie (barre de vie), pour les espèces mobiles
+    if constexpr (Core::TraitsOf<Species>::kMobile) {
+        batch.AddRect(x, y - 3.0f * zoom, size * energyRatio * zoom, 2.0f * zoom, energyBarColor);
+    }
+}
+
+// 🍃 NOURRITURE des cellules [firstColumn, lastColumn] × [firstRow, lastRow]
+static void AddFood(RenderBatch& batch, const Core::FoodField& food, int firstColumn, int firstRow,
+                    int lastColumn, int lastRow, float left, float top, float zoom) {
+    const Core::Color foodColor = Core::Color::Green();
+    float maxSide = std::min(6.0f, food.GetCellSize());
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            std::size_t cell = static_cast<std::size_t>(row) * food.GetColumns() + column;
+            float units = food.GetUnits(cell);
+            if (units < 0.05f) continue;
+            float side = maxSide * std::min(1.0f, 0.3f + units / food.GetCellCapacity());
+            Core::Vector2D center = food.GetCellCenter(cell);
+            batch.AddRect((center.x - side / 2.0f - left) * zoom, (center.y - side / 2.0f - top) * zoom,
+                          side * zoom, side * zoom, foodColor);
+        }
+    }
+}
+
+// 🌍 AJOUT DE LA SCÈNE COMPLÈTE, dans l'ordre de dessin d'origine
+void RenderBatch::AddEcosystem(const Core::Ecosystem& ecosystem) {
+    // Nourriture : un carré par cellule non vide, dont la taille suit la quantité
+    const Core::FoodField& food = ecosystem.GetFoodField();
+    AddFood(*this, food, 0, 0, food.GetColumns() - 1, food.GetRows() - 1, 0.0f, 0.0f, 1.0f);
+
+    // Entités, lues directement dans les tableaux SoA
+    const Core::EntityStore& entities = ecosystem.GetEntities();
+    entities.ForEachSpeciesRange(0, entities.Size(), [&](auto species, std::size_t from, std::size_t to) {
+        for (std::size_t i = from; i < to; ++i) {
+            if (!entities.alive[i]) continue;
+            AddEntity<decltype(species)>(*this, entities, i, 0.0f, 0.0f, 1.0f);
+        }
+    });
+}
+
+// 🎥 VUE DE LA CAMÉRA
+void RenderBatch::AddEcosystem(const Core::Ecosystem& ecosystem, const Camera& camera, const SceneIndex& index) {
+    float zoom = camera.GetZoom();
+    if (zoom < kDensityZoom) {
+        AddDensityTiles(ecosystem, camera, index);
+        return;
+    }
+    float left = camera.GetLeft();
+    float top = camera.GetTop();
+    float right = camera.GetRight();
+    float bottom = camera.GetBottom();
+
+    // Nourriture des seules cellules visibles
+    const Core::FoodField& food = ecosystem.GetFoodField();
+    auto foodColumn = [&food](float x) {
+        return std::clamp(static_cast<int>(std::floor(x / food.GetCellSize())), 0, food.GetColumns() - 1);
+    };
+    auto foodRow = [&food](float y) {
+        return std::clamp(static_cast<int>(std::floor(y / food.GetCellSize())), 0, food.GetRows() - 1);
+    };
+    AddFood(*this, food, foodColumn(left), foodRow(top), foodColumn(right), foodRow(bottom), left, top, zoom);
+
+    // Entités des cellules visibles, élargies de la taille maximale d'une entité
+    const Core::EntityStore& entities = ecosystem.GetEntities();
+    float margin = 0.0f;
+    for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+        margin = std::max(margin, ecosystem.GetSpecies(static_cast<Core::EntityType>(species)).size);
+    }
+    Core::ForEachSpecies([&](auto species) {
+        const Core::SpatialGrid& grid = index.GetGrid(decltype(species)::value);
+        int firstColumn, firstRow, lastColumn, lastRow;
+        grid.GetCellRange(left - margin, top - margin, right + margin, bottom + margin,
+                          firstColumn, firstRow, lastColumn, lastRow);
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                const Core::SpatialGrid::Entry* end = grid.GetCellEnd(column, row);
+                for (const Core::SpatialGrid::Entry* entry = grid.GetCellBegin(column, row); entry != end; ++entry) {
+                    AddEntity<decltype(species)>(*this, entities, entry->id, left, top, zoom);
+                }
+            }
+        }
+    });
+}
+
+// 🟪 TUILES DE DENSITÉ - une tuile par groupe de cellules de l'index, jamais
+// plus petite que kMinTilePixels : le nombre de tuiles est borné par la taille
+// de la fenêtre. Couleur : moyenne des couleurs des espèces pondérée par leurs
+// effectifs ; luminosité : croissante (logarithmiquement) avec l'effectif total.
+void RenderBatch::AddDensityTiles(const Core::Ecosystem& ecosystem, const Camera& camera, const SceneIndex& index) {
+    const Core::SpatialGrid& reference = index.GetGrid(Core::EntityType::HERBIVORE);
+    float zoom = camera.GetZoom();
+    float left = camera.GetLeft();
+    float top = camera.GetTop();
+    float cellSize = reference.GetCellSize();
+    int group = std::max(1, static_cast<int>(std::ceil(kMinTilePixels / (cellSize * zoom))));
+
+    int firstColumn, firstRow, lastColumn, lastRow;
+    reference.GetCellRange(left, top, camera.GetRight(), camera.GetBottom(), firstColumn, firstRow, lastColumn, lastRow);
+    firstColumn -= firstColumn % group;
+    firstRow -= firstRow % group;
+
+    std::array<Core::Color, Core::kSpeciesCount> colors;
+    for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+        colors[species] = ecosystem.GetSpecies(static_cast<Core::EntityType>(species)).color;
+    }
+
+    for (int row = firstRow; row <= lastRow; row += group) {
+        int rowEnd = std::min(row + group, reference.GetRows());
+        for (int column = firstColumn; column <= lastColumn; column += group) {
+            int columnEnd = std::min(column + group, reference.GetColumns());
+            std::array<std::size_t, Core::kSpeciesCount> counts = {};
+            std::size_t total = 0;
+            for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+                const Core::SpatialGrid& grid = index.GetGrid(static_cast<Core::EntityType>(species));
+                for (int r = row; r < rowEnd; ++r) {
+                    for (int c = column; c < columnEnd; ++c) {
+                        counts[species] += static_cast<std::size_t>(grid.GetCellEnd(c, r) - grid.GetCellBegin(c, r));
+                    }
+                }
+                total += counts[species];
+            }
+            if (total == 0) continue;
+
+            float red = 0.0f, green = 0.0f, blue = 0.0f;
+            for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+                float weight = static_cast<float>(counts[species]) / total;
+                red += colors[species].r * weight;
+                green += colors[species].g * weight;
+                blue += colors[species].b * weight;
+            }
+            float brightness = std::min(1.0f, 0.35f + 0.13f * std::log2(static_cast<float>(total)));
+            Core::Color color(static_cast<uint8_t>(red * brightness), static_cast<uint8_t>(green * brightness),
+                              static_cast<uint8_t>(blue * brightness));
+            float side = group * cellSize * zoom;
+            AddRect((column * cellSize - left) * zoom, (row * cellSize - top) * zoom, side, side, color);
+        }
+    }
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -1,20 +1,135 @@
 #include "Graphics/Renderer.hpp"
-#include <iostream> // Pour simuler UI texte, en réalité utiliser SDL_ttf pour texte
+#include "Core/Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
 
 namespace Ecosystem
 {
     namespace Graphics
     {
 
+        // Le sommet du lot doit pouvoir être transmis tel quel à SDL
+        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "Vertex doit avoir la disposition de SDL_Vertex");
+
+        void Renderer::RenderEcosystem(const Core::Ecosystem &ecosystem, const Camera &camera)
+        {
+            {
+                ECOSYSTEM_PROFILE_ZONE("SceneIndex::Update");
+                mSceneIndex.Update(ecosystem);
+            }
+            // Toute la partie visible en un seul appel de dessin, tampons réutilisés
+            {
+                ECOSYSTEM_PROFILE_ZONE("RenderBatch::AddEcosystem");
+                mBatch.Clear();
+                mBatch.AddEcosystem(ecosystem, camera, mSceneIndex);
+            }
+            ECOSYSTEM_PROFILE_ZONE("Renderer::SubmitBatch");
+            SubmitBatch(mBatch);
+        }
+
+        void Renderer::SubmitBatch(const RenderBatch &batch)
+        {
+            if (batch.GetIndices().empty())
+                return;
+            SDL_RenderGeometry(mRenderer, nullptr,
+                               reinterpret_cast<const SDL_Vertex *>(batch.GetVertices().data()),
+                               static_cast<int>(batch.GetVertices().size()),
+                               batch.GetIndices().data(),
+                               static_cast<int>(batch.GetIndices().size()));
+        }
+
+        // 📊 POPULATIONS - une barre par espèce, un pixel par individu (réduite au-delà de 300)
         void Renderer::RenderStatistics(const Core::Ecosystem::Statistics &stats)
         {
-            // AJOUT : Simulation d'UI - en réalité, utiliser SDL_ttf pour texte. Ici, print console.
-            std::cout << "UI Stats: H=" << stats.totalHerbivores << " C=" << stats.totalCarnivores << " P=" << stats.totalPlants << std::endl;
-            // Pour graphique, dessiner barres (exemple)
-            SDL_SetRenderDrawColor(mRenderer, 255, 0, 0, 255);
-            SDL_FRect bar = {10.0f, 10.0f, static_cast<float>(stats.totalHerbivores), 20.0f};
-            SDL_RenderFillRect(mRenderer, &bar);
-            // Ajouter plus pour autres stats...
+            ECOSYSTEM_PROFILE_ZONE("Renderer::RenderStatistics");
+            static constexpr float kMaxWidth = 300.0f;
+            int largest = 1;
+            for (const auto &species : stats.species)
+            {
+                largest = std::max(largest, species.population);
+            }
+            float scale = std::min(1.0f, kMaxWidth / static_cast<float>(largest));
+
+            mOverlay.Clear();
+            for (std::size_t species = 0; species < Core::kSpeciesCount; ++species)
+            {
+                const Core::Color color = Core::DefaultSpecies(static_cast<Core::EntityType>(species)).color;
+                mOverlay.AddRect(10.0f, 10.0f + species * 8.0f, stats.species[species].population * scale, 6.0f, color);
+            }
+            SubmitBatch(mOverlay);
+        }
+
+        // ⏱ HUD DE PROFILAGE
+        // Graphe glissant des durées d'image (vert sous 16,7 ms, jaune sous
+        // 33 ms, rouge au-delà), puis répartition du tick par phase.
+        void Renderer::RenderProfilerHud(const ProfilerHud &hud)
+        {
+            ECOSYSTEM_PROFILE_ZONE("Renderer::RenderProfilerHud");
+            static constexpr float kLeft = 10.0f;
+            static constexpr float kTop = 50.0f;
+            static constexpr float kWidth = 240.0f;
+            static constexpr float kGraphHeight = 60.0f;
+            static constexpr float kBudgetMs = 1000.0f / 60.0f;
+            static constexpr float kScaleMs = 2.0f * kBudgetMs; // Haut du graphe
+            static constexpr float kLineHeight = 10.0f;
+            static const Core::Color kPhaseColors[Core::kPhaseCount] = {
+                Core::Color(120, 120, 120), Core::Color(70, 130, 255), Core::Color(255, 90, 90),
+                Core::Color(255, 200, 40), Core::Color(60, 220, 90), Core::Color(230, 110, 230),
+                Core::Color(160, 90, 40), Core::Color(40, 200, 200), Core::Color(240, 240, 240)};
+
+            const float barTop = kTop + kGraphHeight + 14.0f;
+            const float legendTop = barTop + 18.0f;
+            const float panelHeight = legendTop + Core::kPhaseCount * kLineHeight - kTop + 4.0f;
+
+            mOverlay.Clear();
+            mOverlay.AddRect(kLeft - 4.0f, kTop - 14.0f, kWidth + 8.0f, panelHeight + 14.0f, Core::Color(0, 0, 0, 170));
+
+            // 📈 Durées d'image
+            std::size_t frames = hud.frameMilliseconds.size();
+            float barWidth = frames > 0 ? kWidth / static_cast<float>(frames) : kWidth;
+            for (std::size_t i = 0; i < frames; ++i)
+            {
+                float ms = hud.frameMilliseconds[i];
+                float height = std::min(ms / kScaleMs, 1.0f) * kGraphHeight;
+                Core::Color color = ms <= kBudgetMs ? Core::Color(60, 220, 90)
+                                  : ms <= 2.0f * kBudgetMs ? Core::Color::Yellow() : Core::Color::Red();
+                mOverlay.AddRect(kLeft + i * barWidth, kTop + kGraphHeight - height,
+                                 std::max(barWidth - 1.0f, 1.0f), height, color);
+            }
+            mOverlay.AddRect(kLeft, kTop + kGraphHeight * (1.0f - kBudgetMs / kScaleMs), kWidth, 1.0f,
+                             Core::Color(255, 255, 255, 120));
+
+            // 🧱 Phases du tick, empilées proportionnellement
+            float total = 0.0f;
+            for (float us : hud.phaseMicroseconds)
+                total += us;
+            float x = kLeft;
+            for (std::size_t phase = 0; phase < Core::kPhaseCount; ++phase)
+            {
+                float width = total > 0.0f ? hud.phaseMicroseconds[phase] / total * kWidth : 0.0f;
+                mOverlay.AddRect(x, barTop, width, 12.0f, kPhaseColors[phase]);
+                mOverlay.AddRect(kLeft, legendTop + phase * kLineHeight, 8.0f, 8.0f, kPhaseColors[phase]);
+                x += width;
+            }
+
+            SDL_SetRenderDrawBlendMode(mRenderer, SDL_BLENDMODE_BLEND);
+            SubmitBatch(mOverlay);
+
+            // 🔤 Libellés (police de débogage intégrée à SDL, 8 × 8 pixels)
+            char line[64];
+            float lastFrame = frames > 0 ? hud.frameMilliseconds.back() : 0.0f;
+            SDL_SetRenderDrawColor(mRenderer, 255, 255, 255, 255);
+            std::snprintf(line, sizeof(line), "image %5.1f ms  tick %6.0f us%s", lastFrame,
+                          hud.tickMicroseconds, hud.capturing ? "  [REC]" : "");
+            SDL_RenderDebugText(mRenderer, kLeft, kTop - 10.0f, line);
+            for (std::size_t phase = 0; phase < Core::kPhaseCount; ++phase)
+            {
+                float share = total > 0.0f ? hud.phaseMicroseconds[phase] / total * 100.0f : 0.0f;
+                std::snprintf(line, sizeof(line), "%-13s %8.0f us %3.0f%%",
+                              Core::PhaseName(static_cast<Core::Phase>(phase)),
+                              hud.phaseMicroseconds[phase], share);
+                SDL_RenderDebugText(mRenderer, kLeft + 12.0f, legendTop + phase * kLineHeight, line);
+            }
         }
 
     } // namespace Graphics
@@ -0,0 +1,45 @@
+#include "Graphics/SceneIndex.hpp"
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+SceneIndex::SceneIndex()
+    : mGrids(Core::kSpeciesCount, Core::SpatialGrid(1.0f, 1.0f, kCellSize)),
+      mWorldWidth(0.0f), mWorldHeight(0.0f), mBuiltTick(0), mBuiltSize(0), mValid(false)
+{
+}
+
+// ⚙️ MISE À JOUR
+void SceneIndex::Update(const Core::Ecosystem& ecosystem) {
+    const Core::EntityStore& entities = ecosystem.GetEntities();
+    if (mValid && mBuiltTick == ecosystem.GetDayCycle() && mBuiltSize == entities.Size()) {
+        return;
+    }
+
+    if (mWorldWidth != ecosystem.GetWorldWidth() || mWorldHeight != ecosystem.GetWorldHeight()) {
+        mWorldWidth = ecosystem.GetWorldWidth();
+        mWorldHeight = ecosystem.GetWorldHeight();
+        for (Core::SpatialGrid& grid : mGrids) {
+            grid.Resize(mWorldWidth, mWorldHeight, kCellSize);
+        }
+    }
+
+    for (std::size_t species = 0; species < Core::kSpeciesCount; ++species) {
+        Core::SpatialGrid& grid = mGrids[species];
+        Core::EntityType type = static_cast<Core::EntityType>(species);
+        grid.Clear();
+        for (std::size_t i = entities.SpeciesBegin(type); i < entities.SpeciesEnd(type); ++i) {
+            if (!entities.alive[i]) continue;
+            grid.Insert(static_cast<uint32_t>(i), entities.positionX[i], entities.positionY[i]);
+        }
+        grid.Build();
+    }
+
+    mBuiltTick = ecosystem.GetDayCycle();
+    mBuiltSize = entities.Size();
+    mValid = true;
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
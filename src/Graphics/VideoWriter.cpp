@@ -0,0 +1,177 @@
+#include "Graphics/VideoWriter.hpp"
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Graphics {
+
+static constexpr std::size_t kStreamBuffer = 1 << 20;
+
+// 🏗 CONSTRUCTEUR/DESTRUCTEUR
+VideoWriter::VideoWriter()
+    : mFile(nullptr), mIsPipe(false), mFormat(VideoFormat::Y4M),
+      mWidth(0), mHeight(0), mFrames(0), mStopping(false), mFailed(false)
+{
+}
+
+VideoWriter::~VideoWriter() {
+    Close();
+}
+
+// 🔍 FORMAT
+VideoFormat VideoWriter::FormatFromPath(const std::string& path) {
+    const std::string extension = ".ppm";
+    if (path.size() >= extension.size() &&
+        path.compare(path.size() - extension.size(), extension.size(), extension) == 0) {
+        return VideoFormat::PPM;
+    }
+    return VideoFormat::Y4M;
+}
+
+// 💾 OUVERTURE - l'en-tête Y4M est écrit une fois, celui des PPM à chaque image
+bool VideoWriter::Open(const std::string& path, int width, int height, VideoFormat format, int framesPerSecond) {
+    Close();
+    mIsPipe = !path.empty() && path[0] == '|';
+    if (mIsPipe) {
+        // Un encodeur qui s'arrête doit produire une erreur d'écriture, pas tuer le processus
+        std::signal(SIGPIPE, SIG_IGN);
+        mFile = popen(path.c_str() + 1, "w");
+    } else {
+        mFile = std::fopen(path.c_str(), "wb");
+    }
+    if (!mFile) {
+        std::cerr << "❌ Impossible d'ouvrir le flux vidéo: " << path << std::endl;
+        return false;
+    }
+    std::setvbuf(mFile, nullptr, _IOFBF, kStreamBuffer);
+
+    mPath = path;
+    mFormat = format;
+    mWidth = width;
+    mHeight = height;
+    mFrames = 0;
+    mStopping = false;
+    mFailed = false;
+    if (mFormat == VideoFormat::Y4M &&
+        std::fprintf(mFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", mWidth, mHeight, framesPerSecond) < 0) {
+        mFailed = true;
+    }
+
+    std::size_t frameSize = static_cast<std::size_t>(mWidth) * mHeight * 3;
+    mFree.assign(kBuffers, std::vector<uint8_t>(frameSize));
+    mPending.clear();
+    mWriterThread = std::thread(&VideoWriter::WriterLoop, this);
+    return true;
+}
+
+// 🔒 FERMETURE
+bool VideoWriter::Close() {
+    if (!mFile) return true;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+    mWriterThread.join();
+
+    bool failed = mFailed || std::fflush(mFile) != 0;
+    int status = mIsPipe ? pclose(mFile) : std::fclose(mFile);
+    failed = failed || status != 0;
+    mFile = nullptr;
+    mFree.clear();
+    if (failed) {
+        std::cerr << "❌ Erreur d'écriture du flux vidéo: " << mPath << std::endl;
+        return false;
+    }
+    std::cout << "🎞 Flux vidéo écrit: " << mPath << " (" << mFrames << " images " << mWidth << "x" << mHeight
+              << ")" << std::endl;
+    return true;
+}
+
+// 🎞 SOUMISSION - attend un tampon libre si l'écriture a kBuffers images de retard
+bool VideoWriter::Submit(const std::vector<uint8_t>& rgb) {
+    if (!mFile) return false;
+    std::vector<uint8_t> buffer;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this]() { return !mFree.empty() || mFailed; });
+        if (mFailed) return false;
+        buffer.swap(mFree.back());
+        mFree.pop_back();
+    }
+    std::memcpy(buffer.data(), rgb.data(), std::min(buffer.size(), rgb.size()));
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPending.push_back(std::move(buffer));
+    }
+    mCondition.notify_all();
+    ++mFrames;
+    return true;
+}
+
+// 🔁 THREAD D'ÉCRITURE - conversion et écriture hors du verrou
+void VideoWriter::WriterLoop() {
+    std::vector<uint8_t> planes;
+    while (true) {
+        std::vector<uint8_t> frame;
+        bool failed;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return !mPending.empty() || mStopping; });
+            if (mPending.empty()) break;  // Arrêt demandé, tout est écrit
+            frame.swap(mPending.front());
+            mPending.pop_front();
+            failed = mFailed;
+        }
+        // Après une erreur, les images restantes sont ignorées
+        bool written = !failed && WriteFrame(frame, planes);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFailed = mFailed || !written;
+            mFree.push_back(std::move(frame));
+        }
+        mCondition.notify_all();
+    }
+}
+
+// 📝 UNE IMAGE
+bool VideoWriter::WriteFrame(const std::vector<uint8_t>& rgb, std::vector<uint8_t>& planes) {
+    std::size_t pixels = static_cast<std::size_t>(mWidth) * mHeight;
+    if (mFormat == VideoFormat::PPM) {
+        return std::fprintf(mFile, "P6\n%d %d\n255\n", mWidth, mHeight) > 0 &&
+               std::fwrite(rgb.data(), 1, pixels * 3, mFile) == pixels * 3;
+    }
+
+    // RGB -> Y'CbCr BT.601 en plage limitée, entiers sur 8 bits de précision.
+    // L'image est faite d'aplats : la conversion n'est refaite qu'au changement de couleur.
+    planes.resize(pixels * 3);
+    uint8_t* luma = planes.data();
+    uint8_t* blue = luma + pixels;
+    uint8_t* red = blue + pixels;
+    const uint8_t* pixel = rgb.data();
+    int lastR = -1, lastG = -1, lastB = -1;
+    uint8_t y = 0, cb = 0, cr = 0;
+    for (std::size_t i = 0; i < pixels; ++i, pixel += 3) {
+        int r = pixel[0];
+        int g = pixel[1];
+        int b = pixel[2];
+        if (r != lastR || g != lastG || b != lastB) {
+            y = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+            cb = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            cr = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+            lastR = r;
+            lastG = g;
+            lastB = b;
+        }
+        luma[i] = y;
+        blue[i] = cb;
+        red[i] = cr;
+    }
+    return std::fputs("FRAME\n", mFile) >= 0 &&
+           std::fwrite(planes.data(), 1, planes.size(), mFile) == planes.size();
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
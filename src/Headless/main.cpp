@@ -0,0 +1,494 @@
+#include "Core/Domain.hpp"
+#include "Core/Ecosystem.hpp"
+#include "Core/Ensemble.hpp"
+#include "Core/Log.hpp"
+#include "Core/Profiler.hpp"
+#include "Core/Replay.hpp"
+#include "Core/Telemetry.hpp"
+#include "Graphics/Camera.hpp"
+#include "Graphics/Rasterizer.hpp"
+#include "Graphics/RenderBatch.hpp"
+#include "Graphics/SceneIndex.hpp"
+#include "Graphics/VideoWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ⚙️ PARAMÈTRES DE LA SIMULATION HEADLESS
+struct HeadlessOptions {
+    long long ticks = 10000;
+    float deltaTime = 0.1f;
+    float worldWidth = 1200.0f;
+    float worldHeight = 800.0f;
+    int maxEntities = 500;
+    int herbivores = 20;
+    int carnivores = 5;
+    int plants = 30;
+    uint32_t seed = 42;
+    std::size_t threads = 1;
+    bool verbose = false;
+    std::string loadPath;  // Reprise depuis un instantané au lieu d'une population initiale
+    std::string savePath;  // Instantané écrit en fin de simulation
+    std::string telemetryPath;  // Série temporelle binaire colonnaire
+    std::string csvPath;        // Export CSV de la série en fin de simulation
+    int telemetryInterval = 1;
+    std::string tracePath;      // Trace Chrome des zones de profilage
+    int tileColumns = 0;        // Découpage en tuiles, un processus par tuile (0 = désactivé)
+    int tileRows = 0;
+    std::string sweepPath;      // Spécification d'un balayage de paramètres
+    std::string sweepOutputPath = "sweep_results.csv";
+    std::size_t sweepThreads = 0;  // Exécutions simultanées (0 = tous les cœurs)
+    bool stopOnExtinction = true;
+    std::string recordPath;     // Journal de rejeu de cette simulation
+    int hashInterval = 1;       // Empreinte de l'état tous les N ticks dans le journal
+    std::string replayPath;     // Rejoue un journal et compare les empreintes
+    std::string videoPath;      // Flux Y4M/PPM, fichier ou "|commande"
+    int videoWidth = 1280;
+    int videoHeight = 720;
+    int videoInterval = 1;      // Une image tous les N ticks
+    int videoFps = 30;
+};
+
+static void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --ticks N          Nombre de ticks à simuler (défaut 10000)\n"
+              << "  --dt SECONDES      Pas de temps fixe (défaut 0.1)\n"
+              << "  --world L H        Taille du monde (défaut 1200 800)\n"
+              << "  --max-entities N   Population maximale (défaut 500)\n"
+              << "  --population H C P Herbivores, carnivores, plantes initiaux (défaut 20 5 30)\n"
+              << "  --seed N           Graine aléatoire (défaut 42)\n"
+              << "  --threads N        Threads de simulation, 0 = tous les cœurs (défaut 1)\n"
+              << "  --load FICHIER     Reprend la simulation depuis un instantané\n"
+              << "  --save FICHIER     Sauvegarde un instantané à la fin\n"
+              << "  --telemetry FICHIER  Enregistre les statistiques de chaque tick (binaire colonnaire)\n"
+              << "  --telemetry-every N  Un échantillon tous les N ticks (défaut 1)\n"
+              << "  --csv FICHIER      Exporte la télémétrie en CSV à la fin\n"
+              << "  --export-csv BIN CSV  Convertit un fichier de télémétrie existant puis quitte\n"
+              << "  --trace FICHIER    Écrit une trace Chrome/Perfetto des phases de chaque tick\n"
+              << "  --tiles C L        Découpe le monde en C×L tuiles, un processus par tuile\n"
+              << "  --sweep FICHIER    Balayage de paramètres : une simulation par combinaison\n"
+              << "  --sweep-output FICHIER  Résultats du balayage en CSV (défaut sweep_results.csv)\n"
+              << "  --sweep-threads N  Simulations simultanées, 0 = tous les cœurs (défaut 0)\n"
+              << "  --no-early-stop    Poursuit chaque simulation après une extinction\n"
+              << "  --record FICHIER   Enregistre un journal de rejeu (configuration, empreintes)\n"
+              << "  --hash-every N     Empreinte de l'état tous les N ticks dans le journal (défaut 1)\n"
+              << "  --replay FICHIER   Rejoue un journal et indique le premier tick divergent\n"
+              << "  --video FICHIER    Rendu logiciel du monde entier en Y4M (.ppm : images PPM) ;\n"
+              << "                     \"|commande\" envoie le flux sur l'entrée de la commande\n"
+              << "  --video-size L H   Taille des images (défaut 1280 720)\n"
+              << "  --video-every N    Une image tous les N ticks (défaut 1)\n"
+              << "  --video-fps N      Cadence annoncée dans l'en-tête Y4M (défaut 30)\n"
+              << "  --verbose          Affiche le journal des entités (si compilé avec ECOSYSTEM_LOG_LEVEL bas)\n";
+}
+
+// 🔍 LECTURE DE LA LIGNE DE COMMANDE
+static bool ParseArguments(int argc, char* argv[], HeadlessOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        // Valeur suivante de l'option courante
+        auto next = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "❌ Option " << arg << " incomplète" << std::endl;
+                std::exit(-1);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--ticks") {
+            options.ticks = std::atoll(next());
+        } else if (arg == "--dt") {
+            options.deltaTime = std::strtof(next(), nullptr);
+        } else if (arg == "--world") {
+            options.worldWidth = std::strtof(next(), nullptr);
+            options.worldHeight = std::strtof(next(), nullptr);
+        } else if (arg == "--max-entities") {
+            options.maxEntities = std::atoi(next());
+        } else if (arg == "--population") {
+            options.herbivores = std::atoi(next());
+            options.carnivores = std::atoi(next());
+            options.plants = std::atoi(next());
+        } else if (arg == "--seed") {
+            options.seed = static_cast<uint32_t>(std::strtoul(next(), nullptr, 10));
+        } else if (arg == "--threads") {
+            options.threads = static_cast<std::size_t>(std::strtoul(next(), nullptr, 10));
+        } else if (arg == "--load") {
+            options.loadPath = next();
+        } else if (arg == "--save") {
+            options.savePath = next();
+        } else if (arg == "--telemetry") {
+            options.telemetryPath = next();
+        } else if (arg == "--telemetry-every") {
+            options.telemetryInterval = std::atoi(next());
+        } else if (arg == "--csv") {
+            options.csvPath = next();
+        } else if (arg == "--export-csv") {
+            std::string binaryPath = next();
+            std::string csvPath = next();
+            std::exit(Ecosystem::Core::Telemetry::ExportCsv(binaryPath, csvPath) ? 0 : -1);
+        } else if (arg == "--tiles") {
+            options.tileColumns = std::atoi(next());
+            options.tileRows = std::atoi(next());
+        } else if (arg == "--sweep") {
+            options.sweepPath = next();
+        } else if (arg == "--sweep-output") {
+            options.sweepOutputPath = next();
+        } else if (arg == "--sweep-threads") {
+            options.sweepThreads = static_cast<std::size_t>(std::strtoul(next(), nullptr, 10));
+        } else if (arg == "--no-early-stop") {
+            options.stopOnExtinction = false;
+        } else if (arg == "--record") {
+            options.recordPath = next();
+        } else if (arg == "--hash-every") {
+            options.hashInterval = std::atoi(next());
+        } else if (arg == "--replay") {
+            options.replayPath = next();
+        } else if (arg == "--video") {
+            options.videoPath = next();
+        } else if (arg == "--video-size") {
+            options.videoWidth = std::atoi(next());
+            options.videoHeight = std::atoi(next());
+        } else if (arg == "--video-every") {
+            options.videoInterval = std::atoi(next());
+        } else if (arg == "--video-fps") {
+            options.videoFps = std::atoi(next());
+        } else if (arg == "--trace") {
+            options.tracePath = next();
+        } else if (arg == "--verbose") {
+            options.verbose = true;
+        } else if (arg == "--help" || arg == "-h") {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        } else {
+            std::cerr << "❌ Option inconnue: " << arg << std::endl;
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+#if !ECOSYSTEM_PROFILING
+    if (!options.tracePath.empty()) {
+        std::cerr << "❌ --trace nécessite un build avec ECOSYSTEM_PROFILING=1" << std::endl;
+        return false;
+    }
+#endif
+    if (options.tileColumns > 0 &&
+        (!options.loadPath.empty() || !options.savePath.empty() || !options.telemetryPath.empty() ||
+         !options.tracePath.empty())) {
+        std::cerr << "❌ --tiles n'est pas compatible avec --load, --save, --telemetry ni --trace" << std::endl;
+        return false;
+    }
+    if (!options.sweepPath.empty() &&
+        (options.tileColumns > 0 || !options.loadPath.empty() || !options.savePath.empty() ||
+         !options.telemetryPath.empty() || !options.tracePath.empty())) {
+        std::cerr << "❌ --sweep n'est pas compatible avec --tiles, --load, --save, --telemetry ni --trace" << std::endl;
+        return false;
+    }
+    if ((!options.recordPath.empty() || !options.replayPath.empty()) &&
+        (options.tileColumns > 0 || !options.sweepPath.empty())) {
+        std::cerr << "❌ --record et --replay ne sont pas compatibles avec --tiles ni --sweep" << std::endl;
+        return false;
+    }
+    if (!options.videoPath.empty() &&
+        (options.tileColumns > 0 || !options.sweepPath.empty() || !options.replayPath.empty())) {
+        std::cerr << "❌ --video n'est pas compatible avec --tiles, --sweep ni --replay" << std::endl;
+        return false;
+    }
+    if (!options.videoPath.empty() &&
+        (options.videoWidth <= 0 || options.videoHeight <= 0 || options.videoInterval <= 0 || options.videoFps <= 0)) {
+        std::cerr << "❌ --video-size, --video-every et --video-fps doivent être positifs" << std::endl;
+        return false;
+    }
+    if (!options.csvPath.empty() && options.telemetryPath.empty()) {
+        std::cerr << "❌ --csv nécessite --telemetry" << std::endl;
+        return false;
+    }
+    return options.ticks >= 0 && options.deltaTime > 0.0f &&
+           options.worldWidth > 0.0f && options.worldHeight > 0.0f;
+}
+
+// 🧩 MONDE DÉCOUPÉ EN TUILES - appelé avant toute création de thread
+static int RunTiled(const HeadlessOptions& options) {
+    Ecosystem::Core::Domain::Config config;
+    config.worldWidth = options.worldWidth;
+    config.worldHeight = options.worldHeight;
+    config.columns = options.tileColumns;
+    config.rows = options.tileRows;
+    config.maxEntities = options.maxEntities;
+    config.herbivores = options.herbivores;
+    config.carnivores = options.carnivores;
+    config.plants = options.plants;
+    config.seed = options.seed;
+    config.threadsPerTile = options.threads;
+    config.ticks = options.ticks;
+    config.deltaTime = options.deltaTime;
+
+    Ecosystem::Core::Domain::GlobalStatistics stats;
+    auto start = std::chrono::steady_clock::now();
+    if (!Ecosystem::Core::Domain::Run(config, stats)) {
+        return -1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    double seconds = elapsed.count();
+    std::cout << "📊 Ticks: " << stats.ticks
+              << ", Durée: " << seconds << " s"
+              << ", Ticks/s: " << (seconds > 0.0 ? stats.ticks / seconds : 0.0)
+              << ", Tuiles: " << config.columns << "x" << config.rows << std::endl;
+    std::cout << "📊 Stats -";
+    for (std::size_t species = 0; species < Ecosystem::Core::kSpeciesCount; ++species) {
+        std::cout << " " << Ecosystem::Core::SpeciesName(static_cast<Ecosystem::Core::EntityType>(species)) << ": "
+                  << stats.population[species] << ",";
+    }
+    std::cout << " Naissances: " << stats.births
+              << ", Morts: " << stats.deaths
+              << ", Migrations: " << stats.migrations << std::endl;
+    std::cout << "⏱ Tuile la plus lente: " << stats.slowestUpdateSeconds << " s de simulation, "
+              << stats.slowestExchangeSeconds << " s d'échange" << std::endl;
+    return 0;
+}
+
+// 🎲 BALAYAGE DE PARAMÈTRES
+// Les options de la ligne de commande donnent la configuration de base ;
+// la spécification en fait varier une partie.
+static int RunSweep(const HeadlessOptions& options) {
+    Ecosystem::Core::Ensemble::Sweep sweep;
+    std::string error;
+    if (!sweep.Load(options.sweepPath, error)) {
+        std::cerr << "❌ Balayage " << options.sweepPath << ": " << error << std::endl;
+        return -1;
+    }
+
+    Ecosystem::Core::Ensemble::RunConfig base;
+    base.worldWidth = options.worldWidth;
+    base.worldHeight = options.worldHeight;
+    base.maxEntities = options.maxEntities;
+    base.herbivores = options.herbivores;
+    base.carnivores = options.carnivores;
+    base.plants = options.plants;
+    base.seed = options.seed;
+    base.ticks = options.ticks;
+    base.deltaTime = options.deltaTime;
+    sweep.SetBase(base);
+
+    std::ofstream output(options.sweepOutputPath);
+    if (!output) {
+        std::cerr << "❌ Impossible de créer le fichier: " << options.sweepOutputPath << std::endl;
+        return -1;
+    }
+    std::cout << "🎲 Balayage: " << sweep.GetRunCount() << " exécutions -> " << options.sweepOutputPath << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    if (!Ecosystem::Core::Ensemble::RunSweep(sweep, options.sweepThreads, options.stopOnExtinction, output)) {
+        std::cerr << "❌ Erreur d'écriture: " << options.sweepOutputPath << std::endl;
+        return -1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "📊 Balayage terminé en " << elapsed.count() << " s" << std::endl;
+    return 0;
+}
+
+// 🎬 REJEU D'UN JOURNAL - seuls --threads et --verbose s'appliquent
+static int RunReplay(const HeadlessOptions& options) {
+    Ecosystem::Core::Replay::Log log;
+    if (!Ecosystem::Core::Replay::Load(options.replayPath, log)) {
+        return -1;
+    }
+    std::cout << "🎬 Rejeu: " << log.ticks << " ticks, " << log.inputs.size() << " commandes, "
+              << log.hashes.size() << " empreintes, graine " << log.config.seed << std::endl;
+
+    Ecosystem::Core::Replay::Result result;
+    if (!Ecosystem::Core::Replay::Run(log, options.threads, result)) {
+        return -1;
+    }
+    std::cout << "📊 Ticks: " << result.ticks << ", Durée: " << result.seconds << " s"
+              << ", Ticks/s: " << (result.seconds > 0.0 ? result.ticks / result.seconds : 0.0) << std::endl;
+    if (result.diverged) {
+        std::cout << "❌ Divergence au tick " << result.divergentTick << std::hex
+                  << ": empreinte " << result.actualHash << ", attendue " << result.expectedHash
+                  << std::dec << std::endl;
+        return 1;
+    }
+    std::cout << "✅ Rejeu identique à l'enregistrement" << std::endl;
+    return 0;
+}
+
+// 🎞 EXPORT VIDÉO - monde entier vu par une caméra fixe, rendu sans SDL
+struct VideoExport {
+    Ecosystem::Graphics::Camera camera;
+    Ecosystem::Graphics::SceneIndex index;
+    Ecosystem::Graphics::RenderBatch batch;
+    Ecosystem::Graphics::Rasterizer rasterizer;
+    Ecosystem::Graphics::VideoWriter writer;
+    double seconds = 0.0;  // Temps passé dans la boucle de simulation à produire les images
+
+    explicit VideoExport(const HeadlessOptions& options)
+        : camera(static_cast<float>(options.videoWidth), static_cast<float>(options.videoHeight),
+                 options.worldWidth, options.worldHeight),
+          rasterizer(options.videoWidth, options.videoHeight, options.threads)
+    {
+        camera.Fit();
+    }
+
+    bool Capture(const Ecosystem::Core::Ecosystem& ecosystem) {
+        auto start = std::chrono::steady_clock::now();
+        index.Update(ecosystem);
+        batch.Clear();
+        batch.AddEcosystem(ecosystem, camera, index);
+        rasterizer.Render(batch);
+        bool submitted = writer.Submit(rasterizer.GetPixels());
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return submitted;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    HeadlessOptions options;
+    if (!ParseArguments(argc, argv, options)) {
+        return -1;
+    }
+
+    if (options.tileColumns > 0 || options.tileRows > 0) {
+        return RunTiled(options);
+    }
+    if (!options.sweepPath.empty()) {
+        return RunSweep(options);
+    }
+
+    if (options.verbose) {
+        Ecosystem::Core::Log::Logger::Instance().AddSink(
+            std::make_unique<Ecosystem::Core::Log::StreamSink>(std::cout));
+    }
+    if (!options.replayPath.empty()) {
+        return RunReplay(options);
+    }
+
+    // 🏗 Création de l'écosystème sans fenêtre ni rendu
+    Ecosystem::Core::Ecosystem ecosystem(options.worldWidth, options.worldHeight,
+                                         options.maxEntities, options.seed);
+    ecosystem.SetThreadCount(options.threads);
+    if (!options.loadPath.empty()) {
+        if (!ecosystem.LoadSnapshot(options.loadPath)) {
+            return -1;
+        }
+    } else {
+        ecosystem.Initialize(options.herbivores, options.carnivores, options.plants);
+    }
+
+    // 🎬 Journal de rejeu optionnel
+    Ecosystem::Core::Replay::Recorder replay;
+    if (!options.recordPath.empty()) {
+        Ecosystem::Core::Replay::RunConfig config;
+        config.seed = options.seed;
+        config.deltaTime = options.deltaTime;
+        config.worldWidth = options.worldWidth;
+        config.worldHeight = options.worldHeight;
+        config.maxEntities = options.maxEntities;
+        config.population = {options.herbivores, options.carnivores, options.plants};
+        config.loadPath = options.loadPath;
+        config.hashInterval = static_cast<uint32_t>(std::max(options.hashInterval, 1));
+        if (!replay.Open(options.recordPath, config)) {
+            return -1;
+        }
+    }
+
+    // 🎞 Flux vidéo optionnel ; le monde d'un instantané chargé peut différer de --world
+    std::unique_ptr<VideoExport> video;
+    if (!options.videoPath.empty()) {
+        HeadlessOptions videoOptions = options;
+        videoOptions.worldWidth = ecosystem.GetWorldWidth();
+        videoOptions.worldHeight = ecosystem.GetWorldHeight();
+        video = std::make_unique<VideoExport>(videoOptions);
+        if (!video->writer.Open(options.videoPath, options.videoWidth, options.videoHeight,
+                                Ecosystem::Graphics::VideoWriter::FormatFromPath(options.videoPath),
+                                options.videoFps)) {
+            return -1;
+        }
+    }
+
+    // 📈 Télémétrie optionnelle, écrite en arrière-plan
+    Ecosystem::Core::Telemetry::Recorder telemetry;
+    telemetry.SetInterval(options.telemetryInterval);
+    bool recording = !options.telemetryPath.empty();
+    if (recording && !telemetry.Open(options.telemetryPath)) {
+        return -1;
+    }
+
+    // ⏱ Trace optionnelle, relevée entre deux ticks pour borner les tampons
+    bool tracing = !options.tracePath.empty();
+    std::vector<Ecosystem::Core::Profiler::Event> traceEvents;
+    ECOSYSTEM_PROFILE_THREAD("main");
+    Ecosystem::Core::Profiler::SetCapturing(tracing);
+
+    // 🔄 Boucle à pas fixe, aussi vite que le processeur le permet
+    auto start = std::chrono::steady_clock::now();
+    for (long long tick = 0; tick < options.ticks; ++tick) {
+        ecosystem.Update(options.deltaTime);
+        replay.RecordTick(ecosystem);
+        if (recording) {
+            telemetry.Record(ecosystem);
+        }
+        if (video && (tick + 1) % options.videoInterval == 0 && !video->Capture(ecosystem)) {
+            std::cerr << "❌ Flux vidéo interrompu au tick " << tick + 1 << std::endl;
+            return -1;
+        }
+        if (tracing) {
+            Ecosystem::Core::Profiler::Collect(traceEvents);
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    telemetry.Close();
+    replay.Close();
+    if (video) {
+        if (!video->writer.Close()) {
+            return -1;
+        }
+        std::cout << "🎞 Rendu: " << video->seconds << " s pour " << video->writer.GetFrameCount()
+                  << " images" << std::endl;
+    }
+    if (tracing) {
+        Ecosystem::Core::Profiler::SetCapturing(false);
+        if (!Ecosystem::Core::Profiler::WriteChromeTrace(options.tracePath, traceEvents)) {
+            return -1;
+        }
+    }
+    if (!options.csvPath.empty() &&
+        !Ecosystem::Core::Telemetry::ExportCsv(options.telemetryPath, options.csvPath)) {
+        return -1;
+    }
+
+    // 📊 Résumé
+    const auto& stats = ecosystem.GetStatistics();
+    const auto& distributions = ecosystem.GetDistributions();
+    double seconds = elapsed.count();
+    std::cout << "📊 Ticks: " << options.ticks
+              << ", Durée: " << seconds << " s"
+              << ", Ticks/s: " << (seconds > 0.0 ? options.ticks / seconds : 0.0) << std::endl;
+    std::cout << "📊 Stats -";
+    for (std::size_t species = 0; species < Ecosystem::Core::kSpeciesCount; ++species) {
+        std::cout << " " << Ecosystem::Core::SpeciesName(static_cast<Ecosystem::Core::EntityType>(species)) << ": "
+                  << stats.species[species].population << ",";
+    }
+    std::cout << " Naissances: " << stats.totalBirths
+              << ", Morts: " << stats.totalDeaths << std::endl;
+    for (std::size_t species = 0; species < Ecosystem::Core::kSpeciesCount; ++species) {
+        const auto& detail = stats.species[species];
+        const auto& distribution = distributions[species];
+        std::cout << "🧬 " << Ecosystem::Core::SpeciesName(static_cast<Ecosystem::Core::EntityType>(species))
+                  << " - Naissances: " << detail.births << " (veille " << detail.birthsYesterday << ")"
+                  << ", Morts: " << detail.deaths << " (veille " << detail.deathsYesterday << ")"
+                  << ", Énergie: " << distribution.energy.minimum << " / " << distribution.energy.mean
+                  << " / " << distribution.energy.maximum
+                  << ", Âge: " << distribution.age.minimum << " / " << distribution.age.mean
+                  << " / " << distribution.age.maximum << std::endl;
+    }
+
+    if (!options.savePath.empty() && !ecosystem.SaveSnapshot(options.savePath)) {
+        return -1;
+    }
+    return 0;
+}
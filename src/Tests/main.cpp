@@ -0,0 +1,189 @@
+#include "Core/EntityStore.hpp"
+#include "Core/MotionKernel.hpp"
+#include "Core/Random.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 🧪 TESTS DES NOYAUX DE MOUVEMENT
+// Chaque chemin vectoriel supporté par le processeur doit laisser l'EntityStore
+// dans exactement le même état que le chemin scalaire, champ par champ et bit
+// à bit, et compter les mêmes morts. Le programme s'arrête au premier écart
+// avec un code de sortie non nul.
+
+namespace Core = Ecosystem::Core;
+namespace Motion = Ecosystem::Core::Motion;
+namespace Random = Ecosystem::Core::Random;
+
+static constexpr uint32_t kSeed = 1234;
+
+// 🎭 ÉTAT DE VIE DES ENTITÉS D'UN SCÉNARIO
+enum class AliveMode {
+    ALL,
+    NONE,
+    ALTERNATING,
+    MIXED  // Tirage par entité, environ deux sur trois en vie
+};
+
+static const char* AliveModeName(AliveMode mode) {
+    switch (mode) {
+        case AliveMode::ALL: return "tous vivants";
+        case AliveMode::NONE: return "tous morts";
+        case AliveMode::ALTERNATING: return "alternés";
+        case AliveMode::MIXED: return "mélangés";
+    }
+    return "?";
+}
+
+// 🎲 TIRAGE 0 AUX BORNES DE kTurnChance - un tiers des entités, selon l'indice et le tick
+static void ForceTurnDraws(Core::EntityStore& store, uint64_t tick) {
+    const float draws[] = {Motion::kTurnChance, std::nextafter(Motion::kTurnChance, 0.0f),
+                           std::nextafter(Motion::kTurnChance, 1.0f), 0.0f};
+    for (std::size_t i = 0; i < store.Size(); ++i) {
+        std::size_t pick = (i + tick) % 6;
+        if (pick < 4 && (i + tick) % 3 == 0) {
+            store.uniforms[i][0] = draws[pick];
+        }
+    }
+}
+
+// 🏗 POPULATION DE TEST
+// Herbivores, carnivores et quelques plantes (ignorées par le noyau) pour
+// traverser les plages d'espèces ; énergies proches du seuil de faim pour
+// que des morts tombent dans les blocs vectoriels comme dans la fin de boucle.
+static Core::EntityStore MakeStore(std::size_t count, AliveMode mode, float deltaTime) {
+    Core::EntityStore store;
+    store.SetSeed(kSeed);
+    store.Reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::array<float, 4> spawn = Random::Uniforms(kSeed, i, 0, Random::Stream::SPAWN);
+        Core::EntityType type = spawn[2] < 0.5f ? Core::EntityType::HERBIVORE
+                              : spawn[2] < 0.9f ? Core::EntityType::CARNIVORE : Core::EntityType::PLANT;
+        store.Add(type, Core::Vector2D(spawn[0] * 1000.0f, spawn[1] * 1000.0f));
+    }
+
+    for (std::size_t i = 0; i < store.Size(); ++i) {
+        std::array<float, 4> draw = Random::Uniforms(kSeed, i, 1, Random::Stream::SPAWN);
+        float velocityX = draw[0] * 2.0f - 1.0f;
+        float velocityY = draw[1] * 2.0f - 1.0f;
+        store.velocityX[i] = velocityX;
+        store.velocityY[i] = velocityY;
+        store.speed[i] = std::sqrt(velocityX * velocityX + velocityY * velocityY);
+        store.age[i] = static_cast<int>(draw[3] * store.maxAge[i]);
+
+        // Énergie entre 0 et trois fois la dépense d'un pas ; une sur huit exactement
+        // au métabolisme du pas (énergie nulle après le pas pour une espèce immobile)
+        float spent = store.metabolism[i] * deltaTime + store.speed[i] * deltaTime * 0.1f;
+        store.energy[i] = i % 8 == 0 ? store.metabolism[i] * deltaTime : draw[2] * 3.0f * spent;
+
+        switch (mode) {
+            case AliveMode::ALL: store.alive[i] = 1; break;
+            case AliveMode::NONE: store.alive[i] = 0; break;
+            case AliveMode::ALTERNATING: store.alive[i] = i % 2 == 0; break;
+            case AliveMode::MIXED: store.alive[i] = draw[3] < 0.66f; break;
+        }
+    }
+    return store;
+}
+
+// 🔍 COMPARAISON BIT À BIT D'UN CHAMP
+template <typename T>
+static bool SameField(const char* field, const std::vector<T>& actual, const std::vector<T>& expected,
+                      const std::string& context) {
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        if (std::memcmp(&actual[i], &expected[i], sizeof(T)) != 0) {
+            std::cerr << std::setprecision(9) << "❌ " << context << " : " << field << "[" << i << "] = " << +actual[i]
+                      << ", attendu " << +expected[i] << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool SameState(const Core::EntityStore& actual, const Core::EntityStore& expected, const std::string& context) {
+    return SameField("positionX", actual.positionX, expected.positionX, context) &&
+           SameField("positionY", actual.positionY, expected.positionY, context) &&
+           SameField("velocityX", actual.velocityX, expected.velocityX, context) &&
+           SameField("velocityY", actual.velocityY, expected.velocityY, context) &&
+           SameField("speed", actual.speed, expected.speed, context) &&
+           SameField("energy", actual.energy, expected.energy, context) &&
+           SameField("age", actual.age, expected.age, context) &&
+           SameField("alive", actual.alive, expected.alive, context);
+}
+
+// ▶️ UN SCÉNARIO - [begin, end) avancé de `ticks` pas par chaque chemin
+static bool RunScenario(const Core::EntityStore& initial, std::size_t begin, std::size_t end, float deltaTime,
+                        int ticks, const std::string& name, const std::vector<Motion::Path>& paths) {
+    Core::EntityStore expected = initial;
+    std::vector<Core::EntityStore> stores(paths.size(), initial);
+    for (int tick = 0; tick < ticks; ++tick) {
+        auto prepare = [tick](Core::EntityStore& store) {
+            store.SetTick(static_cast<uint64_t>(tick));
+            store.DrawTickUniforms(0, store.Size());
+            ForceTurnDraws(store, static_cast<uint64_t>(tick));
+        };
+        prepare(expected);
+        std::size_t expectedDeaths = Motion::Advance(Motion::Path::SCALAR, expected, begin, end, deltaTime);
+
+        for (std::size_t p = 0; p < paths.size(); ++p) {
+            prepare(stores[p]);
+            std::size_t deaths = Motion::Advance(paths[p], stores[p], begin, end, deltaTime);
+            std::string context = name + ", " + Motion::PathName(paths[p]) + ", tick " + std::to_string(tick);
+            if (deaths != expectedDeaths) {
+                std::cerr << "❌ " << context << " : " << deaths << " morts, attendu " << expectedDeaths << std::endl;
+                return false;
+            }
+            if (!SameState(stores[p], expected, context)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::vector<Motion::Path> paths;
+    for (Motion::Path path : {Motion::Path::SSE2, Motion::Path::AVX2}) {
+        if (Motion::IsSupported(path)) {
+            paths.push_back(path);
+        } else {
+            std::cout << "⚠️ Chemin " << Motion::PathName(path) << " non supporté par ce processeur, ignoré" << std::endl;
+        }
+    }
+
+    // Tailles autour des largeurs vectorielles (fins de boucle plus courtes que 4 et 8),
+    // débuts de bloc décalés, plusieurs pas de temps et états de vie
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 7, 8, 9, 12, 15, 16, 17, 31, 33, 100, 1000};
+    const std::size_t offsets[] = {0, 1, 3};
+    const float deltaTimes[] = {0.016f, 0.1f, 0.5f};
+    const AliveMode modes[] = {AliveMode::ALL, AliveMode::NONE, AliveMode::ALTERNATING, AliveMode::MIXED};
+
+    int scenarios = 0;
+    for (float deltaTime : deltaTimes) {
+        for (AliveMode mode : modes) {
+            for (std::size_t size : sizes) {
+                for (std::size_t offset : offsets) {
+                    Core::EntityStore store = MakeStore(offset + size, mode, deltaTime);
+                    std::string name = std::to_string(size) + " entités depuis " + std::to_string(offset) +
+                                       ", " + AliveModeName(mode) + ", dt " + std::to_string(deltaTime);
+                    if (!RunScenario(store, offset, store.Size(), deltaTime, 4, name, paths)) {
+                        return 1;
+                    }
+                    ++scenarios;
+                }
+            }
+        }
+    }
+
+    std::cout << "✅ " << scenarios << " scénarios identiques au chemin scalaire (";
+    for (std::size_t p = 0; p < paths.size(); ++p) {
+        std::cout << (p > 0 ? ", " : "") << Motion::PathName(paths[p]);
+    }
+    std::cout << ")" << std::endl;
+    return 0;
+}
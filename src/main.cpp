@@ -1,23 +1,75 @@
-#include "Core/GameEngine.hpp"
+#include "Engine/GameEngine.hpp"
+#include "Core/Log.hpp"
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <cstdlib>
-#include <ctime>
+#include <string>
 
 int main(int argc, char* argv[]) {
-    // 🎲 Initialisation de l'aléatoire
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    
     std::cout << "🎮 Démarrage du Simulateur d'Écosystème" << std::endl;
     std::cout << "=======================================" << std::endl;
     
+    // 📜 Journal des entités vers la console (mis en forme en arrière-plan)
+    Ecosystem::Core::Log::Logger::Instance().AddSink(
+        std::make_unique<Ecosystem::Core::Log::StreamSink>(std::cout));
+    
+    // 🌍 Monde et population : ecosystem --world L H --max-entities N --population H C P
+    // (par défaut, le monde a la taille de la fenêtre)
+    const float windowWidth = 1200.0f;
+    const float windowHeight = 800.0f;
+    float worldWidth = windowWidth;
+    float worldHeight = windowHeight;
+    int maxEntities = 500;
+    int population[3] = {20, 5, 30};
+    // 🎲 Sans --seed, une graine nouvelle à chaque lancement, affichée pour pouvoir la rejouer
+    uint32_t seed = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    std::string recordPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--world" && i + 2 < argc) {
+            worldWidth = std::strtof(argv[++i], nullptr);
+            worldHeight = std::strtof(argv[++i], nullptr);
+        } else if (arg == "--max-entities" && i + 1 < argc) {
+            maxEntities = std::atoi(argv[++i]);
+        } else if (arg == "--population" && i + 3 < argc) {
+            for (int& count : population) {
+                count = std::atoi(argv[++i]);
+            }
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        }
+    }
+    if (worldWidth <= 0.0f || worldHeight <= 0.0f || maxEntities <= 0) {
+        std::cerr << "❌ Erreur: taille du monde ou population maximale invalide" << std::endl;
+        return -1;
+    }
+
     // 🏗 Création du moteur de jeu
-    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", 1200.0f, 800.0f);
+    Ecosystem::Engine::GameEngine engine("Simulateur d'Écosystème Intelligent", windowWidth, windowHeight,
+                                         worldWidth, worldHeight, maxEntities, seed);
+    std::cout << "🎲 Graine: " << seed << std::endl;
+    engine.SetInitialPopulation(population[0], population[1], population[2]);
     
     // ⚙️ Initialisation
     if (!engine.Initialize()) {
         std::cerr << "❌ Erreur: Impossible d'initialiser le moteur de jeu" << std::endl;
         return -1;
     }
+
+    // 💾 Reprise optionnelle : ecosystem --load FICHIER
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == "--load" && !engine.LoadSnapshot(argv[i + 1])) {
+            return -1;
+        }
+    }
+
+    // 🎬 Enregistrement optionnel : ecosystem --record FICHIER, rejoué par ecosystem_headless --replay
+    if (!recordPath.empty() && !engine.StartRecording(recordPath)) {
+        return -1;
+    }
     
     std::cout << "✅ Moteur initialisé avec succès" << std::endl;
     std::cout << "🎯 Lancement de la simulation..." << std::endl;
@@ -26,6 +78,9 @@ int main(int argc, char* argv[]) {
     std::cout << "R: Reset simulation" << std::endl;
     std::cout << "F: Ajouter nourriture" << std::endl;
     std::cout << "FLÈCHES: Vitesse simulation" << std::endl;
+    std::cout << "T: Mode turbo (simulation à pleine vitesse)" << std::endl;
+    std::cout << "F5 / F9: Sauvegarder / charger l'instantané" << std::endl;
+    std::cout << "MOLETTE / + / -: Zoom, GLISSER: Déplacer la vue, ORIGINE: Monde entier" << std::endl;
     std::cout << "ÉCHAP: Quitter" << std::endl;
     
     // 🎮 Boucle principale